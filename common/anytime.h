@@ -0,0 +1,98 @@
+#ifndef ANYTIME_H
+#define ANYTIME_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+/*
+ * Wspólny interfejs algorytmów "anytime" dla lab_02 i lab_04.
+ *
+ * Algorytm przeszukiwania dostaje AnytimeControl: flagę przerwania (ustawianą przez wywołującego
+ * z dowolnego wątku), termin zakończenia oraz funkcję wywoływaną przy każdej poprawie rozwiązania.
+ * Przerwany algorytm kończy się szybko i zwraca najlepsze dotąd znalezione rozwiązanie.
+ */
+
+/**
+ * @brief Sterowanie przeszukiwaniem: flaga przerwania, termin i powiadomienia o poprawie
+ */
+struct AnytimeControl {
+    using Clock = std::chrono::steady_clock;
+
+    /// Wartość (Cmax) i permutacja każdego kolejnego, lepszego rozwiązania
+    using ImprovementCallback = std::function<void(int value, const std::vector<int> &solution)>;
+
+    const std::atomic<bool> *stopToken = nullptr;           ///< Flaga przerwania (nullptr - brak)
+    Clock::time_point deadline = Clock::time_point::max();  ///< Termin zakończenia (max - brak)
+    ImprovementCallback onImprovement;                      ///< Wywoływana przy każdej poprawie (może być pusta)
+    mutable std::atomic<bool> stopObserved{false};          ///< Czy algorytm zobaczył przerwanie (ustawia stopRequested)
+
+    /**
+     * @brief Ustawia termin zakończenia na seconds sekund od teraz
+     */
+    void setTimeLimit(double seconds) {
+        deadline = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    /**
+     * @brief Sprawdza flagę przerwania i termin (odczyt zegara tylko, gdy termin jest ustawiony)
+     * @return true, jeśli algorytm powinien się zakończyć
+     */
+    bool stopRequested() const {
+        const bool stop = (stopToken && stopToken->load(std::memory_order_relaxed)) ||
+                          (deadline != Clock::time_point::max() && Clock::now() >= deadline);
+        if (stop) {
+            stopObserved.store(true, std::memory_order_relaxed);
+        }
+        return stop;
+    }
+
+    /**
+     * @brief Sprawdza, czy algorytm przerwał pracę: true tylko wtedy, gdy któryś test stopRequested()
+     * wewnątrz algorytmu zwrócił true, a nie gdy termin minął już po zakończeniu przeszukiwania
+     */
+    bool interrupted() const { return stopObserved.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Zgłasza lepsze rozwiązanie. Algorytmy wielowątkowe wywołują to pod blokadą,
+     * więc kolejne wartości są ściśle malejące, a wywołania nie nakładają się.
+     */
+    void improved(int value, const std::vector<int> &solution) const {
+        if (onImprovement) {
+            onImprovement(value, solution);
+        }
+    }
+};
+
+/**
+ * @class AnytimePoller
+ * @brief Tani test przerwania do gorących pętli jednego wątku.
+ *
+ * AnytimeControl::stopRequested() sprawdzane jest co interval wywołań shouldStop(), a raz wykryte
+ * przerwanie jest zapamiętywane. Koszt pozostałych wywołań to dekrementacja licznika.
+ */
+class AnytimePoller {
+private:
+    const AnytimeControl &control;  ///< Sprawdzane sterowanie
+    unsigned interval;              ///< Co ile wywołań sprawdzamy flagę i zegar
+    unsigned countdown = 1;         ///< Wywołania do następnego sprawdzenia (pierwsze sprawdza od razu)
+    bool stopped = false;           ///< Czy przerwanie zostało już wykryte
+
+public:
+    explicit AnytimePoller(const AnytimeControl &control, unsigned interval = 1024)
+            : control(control), interval(interval > 0 ? interval : 1) {}
+
+    /**
+     * @brief Zwraca true, jeśli algorytm powinien się zakończyć
+     */
+    bool shouldStop() {
+        if (--countdown == 0) {
+            countdown = interval;
+            stopped = stopped || control.stopRequested();
+        }
+        return stopped;
+    }
+};
+
+#endif //ANYTIME_H
@@ -0,0 +1,159 @@
+#ifndef BINARY_INSTANCE_H
+#define BINARY_INSTANCE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+ * Binarny format instancji wspólny dla lab_02 (1|r_j,q_j|Cmax) i lab_04 (flow shop).
+ *
+ * Plik zaczyna się 64-bajtowym nagłówkiem, po którym następują kolumny int32 (little-endian),
+ * każda wyrównana do 64 bajtów: dla 1|r_j,q_j|Cmax kolejno r, p, q, dla flow shop czasy
+ * przetwarzania na maszynach 1..m. Po odwzorowaniu pliku w pamięci kolumn można używać
+ * bezpośrednio, bez kopiowania i parsowania.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "Binarny format instancji zakłada architekturę little-endian"
+#endif
+
+/**
+ * @brief Rodzaj danych zapisanych w pliku binarnym
+ */
+enum class BinaryInstanceKind : uint32_t {
+    RPQ = 1,      ///< Kolumny r, p, q problemu 1|r_j,q_j|Cmax
+    FlowShop = 2  ///< Kolumna czasów przetwarzania dla każdej maszyny
+};
+
+constexpr char BINARY_INSTANCE_MAGIC[8] = {'S', 'P', 'D', 'I', 'N', 'S', 'T', '\0'};
+constexpr uint32_t BINARY_INSTANCE_VERSION = 1;
+constexpr uint64_t BINARY_INSTANCE_ALIGNMENT = 64;
+
+/**
+ * @brief Nagłówek pliku binarnego (64 bajty)
+ */
+struct BinaryInstanceHeader {
+    char magic[8];          ///< BINARY_INSTANCE_MAGIC
+    uint32_t version;       ///< BINARY_INSTANCE_VERSION
+    uint32_t kind;          ///< BinaryInstanceKind
+    uint32_t jobs;          ///< Liczba zadań (długość każdej kolumny)
+    uint32_t columns;       ///< Liczba kolumn (3 dla RPQ, liczba maszyn dla flow shop)
+    uint64_t columnOffset;  ///< Przesunięcie pierwszej kolumny od początku pliku
+    uint64_t columnStride;  ///< Odległość między początkami kolejnych kolumn w bajtach
+    uint8_t reserved[24];   ///< Zera - miejsce na przyszłe wersje
+};
+
+static_assert(sizeof(BinaryInstanceHeader) == 64, "Nagłówek musi mieć 64 bajty");
+
+/**
+ * @brief Odległość między kolumnami: jobs liczb int32 zaokrąglone w górę do wyrównania
+ */
+inline uint64_t binaryColumnStride(uint32_t jobs) {
+    return (uint64_t(jobs) * sizeof(int32_t) + BINARY_INSTANCE_ALIGNMENT - 1) / BINARY_INSTANCE_ALIGNMENT *
+           BINARY_INSTANCE_ALIGNMENT;
+}
+
+/**
+ * @brief Sprawdza, czy dane zaczynają się od sygnatury formatu binarnego
+ */
+inline bool isBinaryInstance(const char *data, size_t size) {
+    return size >= sizeof(BINARY_INSTANCE_MAGIC) &&
+           std::memcmp(data, BINARY_INSTANCE_MAGIC, sizeof(BINARY_INSTANCE_MAGIC)) == 0;
+}
+
+/**
+ * @brief Sprawdza nagłówek i rozmiar pliku binarnego
+ * @param data Początek pliku (wyrównany co najmniej do 64 bajtów, np. odwzorowanie mmap)
+ * @param size Rozmiar pliku
+ * @param kind Oczekiwany rodzaj danych
+ * @param error Otrzymuje opis błędu
+ * @return Nagłówek albo nullptr, jeśli plik jest niepoprawny
+ */
+inline const BinaryInstanceHeader *readBinaryHeader(const char *data, size_t size, BinaryInstanceKind kind,
+                                                    std::string &error) {
+    if (size < sizeof(BinaryInstanceHeader) || !isBinaryInstance(data, size)) {
+        error = "Brak nagłówka formatu binarnego";
+        return nullptr;
+    }
+
+    const auto *header = reinterpret_cast<const BinaryInstanceHeader *>(data);
+    if (header->version != BINARY_INSTANCE_VERSION) {
+        error = "Nieobsługiwana wersja formatu binarnego: " + std::to_string(header->version);
+        return nullptr;
+    }
+    if (header->kind != static_cast<uint32_t>(kind)) {
+        error = "Plik zawiera inny rodzaj instancji (" + std::to_string(header->kind) + ")";
+        return nullptr;
+    }
+    const uint64_t offset = header->columnOffset, stride = header->columnStride;
+    if (offset % BINARY_INSTANCE_ALIGNMENT != 0 || stride % BINARY_INSTANCE_ALIGNMENT != 0 ||
+        stride < uint64_t(header->jobs) * sizeof(int32_t) || offset > size ||
+        (stride > 0 && header->columns > (size - offset) / stride)) {
+        error = "Niepoprawny układ kolumn albo obcięty plik";
+        return nullptr;
+    }
+    return header;
+}
+
+/**
+ * @brief Zwraca wskaźnik na kolumnę column pliku binarnego (bez kopiowania)
+ */
+inline const int32_t *binaryColumn(const char *data, const BinaryInstanceHeader &header, uint32_t column) {
+    return reinterpret_cast<const int32_t *>(data + header.columnOffset + column * header.columnStride);
+}
+
+/**
+ * @brief Tworzy nagłówek pliku z kolumnami zapisanymi bezpośrednio po nim
+ * (do zapisu strumieniowego, gdy kolumny nie mieszczą się w pamięci naraz)
+ */
+inline BinaryInstanceHeader makeBinaryHeader(BinaryInstanceKind kind, uint32_t jobs, uint32_t columns) {
+    BinaryInstanceHeader header{};
+    std::memcpy(header.magic, BINARY_INSTANCE_MAGIC, sizeof(header.magic));
+    header.version = BINARY_INSTANCE_VERSION;
+    header.kind = static_cast<uint32_t>(kind);
+    header.jobs = jobs;
+    header.columns = columns;
+    header.columnOffset = sizeof(BinaryInstanceHeader);
+    header.columnStride = binaryColumnStride(jobs);
+    return header;
+}
+
+/**
+ * @brief Zapisuje instancję w formacie binarnym
+ * @param path Ścieżka pliku wynikowego
+ * @param kind Rodzaj danych
+ * @param jobs Liczba zadań
+ * @param columns Wskaźniki na kolumny (każda ma jobs elementów)
+ * @param error Otrzymuje opis błędu
+ * @return true, jeśli zapis się powiódł
+ */
+inline bool writeBinaryInstance(const std::string &path, BinaryInstanceKind kind, uint32_t jobs,
+                                const std::vector<const int32_t *> &columns, std::string &error) {
+    const BinaryInstanceHeader header = makeBinaryHeader(kind, jobs, static_cast<uint32_t>(columns.size()));
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        error = "Nie można utworzyć pliku: " + path;
+        return false;
+    }
+
+    static const char padding[BINARY_INSTANCE_ALIGNMENT] = {};
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const int32_t *column: columns) {
+        const uint64_t bytes = uint64_t(jobs) * sizeof(int32_t);
+        file.write(reinterpret_cast<const char *>(column), static_cast<std::streamsize>(bytes));
+        file.write(padding, static_cast<std::streamsize>(header.columnStride - bytes));
+    }
+
+    if (!file) {
+        error = "Błąd zapisu pliku: " + path;
+        return false;
+    }
+    return true;
+}
+
+#endif //BINARY_INSTANCE_H
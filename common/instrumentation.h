@@ -0,0 +1,373 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#if defined(SCHEDULING_INSTRUMENTATION) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Instrumentacja gorących ścieżek algorytmów wspólna dla lab_02 i lab_04.
+ *
+ * Włączana w czasie kompilacji makrem SCHEDULING_INSTRUMENTATION (opcja CMake INSTRUMENTATION=ON).
+ * Liczniki zdarzeń i czasy faz są osobne dla każdego wątku (thread_local), więc zliczanie nie wymaga
+ * synchronizacji, a Probe odczytuje wartości wątku, który go utworzył. Probe może też odczytać
+ * liczniki sprzętowe przez perf_event_open (cykle, chybienia pamięci podręcznej, błędne predykcje
+ * skoków) - jeśli jądro na to nie pozwala, próbka ma hardware.valid == false.
+ *
+ * Bez SCHEDULING_INSTRUMENTATION makra INSTRUMENT_* rozwijają się do pustych instrukcji (argumenty
+ * nie są obliczane), a Probe zwraca puste próbki, więc algorytmy kompilują się do tego samego kodu.
+ */
+
+namespace instrumentation {
+
+/**
+ * @brief Zliczane zdarzenia
+ */
+enum class Counter {
+    HeapPush,     ///< Wstawienie do kopca
+    HeapPop,      ///< Zdjęcie ze szczytu kopca
+    IdleJump,     ///< Przesunięcie zegara do najbliższego czasu dostępności (maszyna bezczynna)
+    Evaluation,   ///< Pełne obliczenie Cmax permutacji
+    Insertion,    ///< Sprawdzona pozycja wstawienia (NEH)
+    Improvement,  ///< Poprawa najlepszego rozwiązania
+    Count
+};
+
+/**
+ * @brief Mierzone fazy algorytmów
+ */
+enum class Phase {
+    Prepare,    ///< Sortowanie i przygotowanie danych
+    Construct,  ///< Budowa rozwiązania (pętla szeregowania, wstawianie)
+    Search,     ///< Przeszukiwanie przestrzeni rozwiązań
+    Count
+};
+
+constexpr int COUNTERS = static_cast<int>(Counter::Count);
+constexpr int PHASES = static_cast<int>(Phase::Count);
+
+#ifdef SCHEDULING_INSTRUMENTATION
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+inline const char *counterName(Counter counter) {
+    static const char *const names[COUNTERS] = {"heap_push", "heap_pop", "idle_jump",
+                                                "evaluation", "insertion", "improvement"};
+    return names[static_cast<int>(counter)];
+}
+
+inline const char *phaseName(Phase phase) {
+    static const char *const names[PHASES] = {"prepare", "construct", "search"};
+    return names[static_cast<int>(phase)];
+}
+
+/**
+ * @brief Stan liczników programowych jednego wątku
+ */
+struct Snapshot {
+    uint64_t counters[COUNTERS] = {};
+    uint64_t nanoseconds[PHASES] = {};
+
+    uint64_t operator[](Counter counter) const { return counters[static_cast<int>(counter)]; }
+
+    Snapshot operator-(const Snapshot &other) const {
+        Snapshot difference;
+        for (int c = 0; c < COUNTERS; c++) {
+            difference.counters[c] = counters[c] - other.counters[c];
+        }
+        for (int f = 0; f < PHASES; f++) {
+            difference.nanoseconds[f] = nanoseconds[f] - other.nanoseconds[f];
+        }
+        return difference;
+    }
+};
+
+/**
+ * @brief Liczniki sprzętowe zmierzonego fragmentu (tylko przestrzeń użytkownika)
+ */
+struct HardwareCounters {
+    bool valid = false;         ///< false - liczniki niedostępne (brak uprawnień, maszyna wirtualna, inny system)
+    uint64_t cycles = 0;
+    uint64_t cacheMisses = 0;
+    uint64_t branchMisses = 0;
+};
+
+/**
+ * @brief Wynik pomiaru: przyrost liczników programowych i liczniki sprzętowe
+ */
+struct Sample {
+    Snapshot software;
+    HardwareCounters hardware;
+};
+
+#ifdef SCHEDULING_INSTRUMENTATION
+
+/**
+ * @brief Liczniki bieżącego wątku
+ */
+inline Snapshot &threadSnapshot() {
+    thread_local Snapshot snapshot;
+    return snapshot;
+}
+
+inline void add(Counter counter, uint64_t value) {
+    threadSnapshot().counters[static_cast<int>(counter)] += value;
+}
+
+/**
+ * @brief Dolicza czas od konstrukcji do destrukcji do fazy phase bieżącego wątku
+ */
+class ScopedTimer {
+private:
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    explicit ScopedTimer(Phase phase) : phase(phase), start(std::chrono::steady_clock::now()) {}
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    ~ScopedTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        threadSnapshot().nanoseconds[static_cast<int>(phase)] +=
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+};
+
+/**
+ * @brief Grupa liczników perf_event_open (cykle, chybienia cache, błędne predykcje) bieżącego wątku
+ */
+class PerfCounters {
+private:
+#ifdef __linux__
+    int fd[3] = {-1, -1, -1};
+
+    static int open(uint64_t config, int group) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group, 0));
+    }
+#endif
+
+public:
+    PerfCounters() {
+#ifdef __linux__
+        fd[0] = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (fd[0] != -1) {
+            fd[1] = open(PERF_COUNT_HW_CACHE_MISSES, fd[0]);
+            fd[2] = open(PERF_COUNT_HW_BRANCH_MISSES, fd[0]);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int descriptor: fd) {
+            if (descriptor != -1) {
+                close(descriptor);
+            }
+        }
+#endif
+    }
+
+    bool available() const {
+#ifdef __linux__
+        return fd[0] != -1 && fd[1] != -1 && fd[2] != -1;
+#else
+        return false;
+#endif
+    }
+
+    void start() {
+#ifdef __linux__
+        if (available()) {
+            ioctl(fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    HardwareCounters stop() {
+        HardwareCounters result;
+#ifdef __linux__
+        if (available()) {
+            ioctl(fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            uint64_t values[4] = {};  // Liczba liczników, a po niej ich wartości w kolejności otwarcia
+            if (read(fd[0], values, sizeof(values)) == static_cast<ssize_t>(sizeof(values)) && values[0] == 3) {
+                result = {true, values[1], values[2], values[3]};
+            }
+        }
+#endif
+        return result;
+    }
+};
+
+#endif
+
+/**
+ * @brief Pomiar fragmentu kodu: od konstrukcji do finish() na tym samym wątku.
+ *
+ * Otwiera liczniki sprzętowe (jeśli hardware == true i jądro pozwala) i zapamiętuje liczniki
+ * programowe wątku. Bez SCHEDULING_INSTRUMENTATION nic nie robi.
+ */
+class Probe {
+#ifdef SCHEDULING_INSTRUMENTATION
+private:
+    Snapshot before;
+    PerfCounters perf;
+    bool hardware;
+
+public:
+    explicit Probe(bool hardware = true) : before(threadSnapshot()), hardware(hardware) {
+        if (hardware) {
+            perf.start();
+        }
+    }
+
+    Sample finish() {
+        Sample sample;
+        if (hardware) {
+            sample.hardware = perf.stop();
+        }
+        sample.software = threadSnapshot() - before;
+        return sample;
+    }
+#else
+public:
+    explicit Probe(bool = true) {}
+
+    Sample finish() { return Sample(); }
+#endif
+};
+
+/**
+ * @brief Opis niezerowych liczników próbki, np. "heap_pop=1000 construct=0.12ms cycles=..."
+ */
+inline std::string describe(const Sample &sample) {
+    std::string text;
+    auto append = [&text](const std::string &item) {
+        text += text.empty() ? item : " " + item;
+    };
+    for (int c = 0; c < COUNTERS; c++) {
+        if (sample.software.counters[c] > 0) {
+            append(std::string(counterName(static_cast<Counter>(c))) + "=" +
+                   std::to_string(sample.software.counters[c]));
+        }
+    }
+    for (int f = 0; f < PHASES; f++) {
+        if (sample.software.nanoseconds[f] > 0) {
+            append(std::string(phaseName(static_cast<Phase>(f))) + "=" +
+                   std::to_string(sample.software.nanoseconds[f] / 1000) + "us");
+        }
+    }
+    if (sample.hardware.valid) {
+        append("cycles=" + std::to_string(sample.hardware.cycles));
+        append("cache_misses=" + std::to_string(sample.hardware.cacheMisses));
+        append("branch_misses=" + std::to_string(sample.hardware.branchMisses));
+    }
+    return text.empty() ? "-" : text;
+}
+
+/**
+ * @brief Nagłówek kolumny tabeli tekstowej dla tableColumn (pusty bez instrumentacji)
+ */
+inline std::string tableHeader() {
+    return ENABLED ? "  instrumentacja" : "";
+}
+
+/**
+ * @brief Kolumna tabeli tekstowej z opisem próbki (pusta bez instrumentacji)
+ */
+inline std::string tableColumn(const Sample &sample) {
+    return ENABLED ? "  " + describe(sample) : "";
+}
+
+/**
+ * @brief Nagłówek kolumn CSV dla csvRow (rozpoczyna się przecinkiem)
+ */
+inline std::string csvHeader() {
+    std::string header;
+    for (int c = 0; c < COUNTERS; c++) {
+        header += std::string(",") + counterName(static_cast<Counter>(c));
+    }
+    for (int f = 0; f < PHASES; f++) {
+        header += std::string(",") + phaseName(static_cast<Phase>(f)) + "_ns";
+    }
+    return header + ",cycles,cache_misses,branch_misses";
+}
+
+/**
+ * @brief Wartości kolumn csvHeader (liczniki sprzętowe puste, jeśli niedostępne)
+ */
+inline std::string csvRow(const Sample &sample) {
+    std::string row;
+    for (int c = 0; c < COUNTERS; c++) {
+        row += "," + std::to_string(sample.software.counters[c]);
+    }
+    for (int f = 0; f < PHASES; f++) {
+        row += "," + std::to_string(sample.software.nanoseconds[f]);
+    }
+    if (!sample.hardware.valid) {
+        return row + ",,,";
+    }
+    return row + "," + std::to_string(sample.hardware.cycles) + "," + std::to_string(sample.hardware.cacheMisses) +
+           "," + std::to_string(sample.hardware.branchMisses);
+}
+
+/**
+ * @brief Obiekt JSON z polami o nazwach kolumn csvHeader (liczniki sprzętowe null, jeśli niedostępne)
+ */
+inline std::string jsonObject(const Sample &sample) {
+    std::string object = "{";
+    for (int c = 0; c < COUNTERS; c++) {
+        object += std::string("\"") + counterName(static_cast<Counter>(c)) + "\": " +
+                  std::to_string(sample.software.counters[c]) + ", ";
+    }
+    for (int f = 0; f < PHASES; f++) {
+        object += std::string("\"") + phaseName(static_cast<Phase>(f)) + "_ns\": " +
+                  std::to_string(sample.software.nanoseconds[f]) + ", ";
+    }
+    auto hardware = [&sample](uint64_t value) {
+        return sample.hardware.valid ? std::to_string(value) : std::string("null");
+    };
+    return object + "\"cycles\": " + hardware(sample.hardware.cycles) +
+           ", \"cache_misses\": " + hardware(sample.hardware.cacheMisses) +
+           ", \"branch_misses\": " + hardware(sample.hardware.branchMisses) + "}";
+}
+
+} // namespace instrumentation
+
+#define INSTRUMENT_CONCAT_(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_(a, b)
+
+#ifdef SCHEDULING_INSTRUMENTATION
+#define INSTRUMENT_ADD(counter, value) ::instrumentation::add(::instrumentation::Counter::counter, (value))
+#define INSTRUMENT_COUNT(counter) INSTRUMENT_ADD(counter, 1)
+#define INSTRUMENT_SCOPE(phase) \
+    ::instrumentation::ScopedTimer INSTRUMENT_CONCAT(instrumentTimer, __LINE__)(::instrumentation::Phase::phase)
+#else
+#define INSTRUMENT_ADD(counter, value) static_cast<void>(0)
+#define INSTRUMENT_COUNT(counter) static_cast<void>(0)
+#define INSTRUMENT_SCOPE(phase) static_cast<void>(0)
+#endif
+
+#endif //INSTRUMENTATION_H
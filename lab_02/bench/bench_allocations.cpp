@@ -0,0 +1,102 @@
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <queue>
+#include <string>
+#include "alg_00_heuristic.h"
+#include "alg_01_schrage.h"
+#include "alg_02_brute_force.h"
+#include "alg_03_wspt.h"
+#include "alg_04_carlier.h"
+#include "alg_06_bitmask_dp.h"
+#include "alg_07_tabu.h"
+#include "allocation_counter.h"
+#include "bench_common.h"
+
+/**
+ * @brief Schrage w dawnym stylu: kopia wektora zadań i robocze std::vector tworzone przy każdym wywołaniu.
+ *
+ * Punkt odniesienia ("przed") dla wariantów korzystających z Instance i ScratchArena.
+ */
+static int legacySchrage(std::vector<task> tasks, std::vector<task> &scheduled) {
+    std::sort(tasks.begin(), tasks.end(), [](const task &a, const task &b) { return a.r < b.r; });
+
+    auto byQ = [](const task &a, const task &b) { return a.q < b.q; };
+    std::priority_queue<task, std::vector<task>, decltype(byQ)> available(byQ);
+
+    scheduled.clear();
+    int currentTime = 0, Cmax = 0;
+    size_t index = 0;
+    while (index < tasks.size() || !available.empty()) {
+        while (index < tasks.size() && tasks[index].r <= currentTime) {
+            available.push(tasks[index++]);
+        }
+        if (!available.empty()) {
+            task currentTask = available.top();
+            available.pop();
+            scheduled.push_back(currentTask);
+            currentTime += currentTask.p;
+            Cmax = std::max(Cmax, currentTime + currentTask.q);
+        } else {
+            currentTime = tasks[index].r;
+        }
+    }
+    return Cmax;
+}
+
+/**
+ * @brief Wypisuje liczbę alokacji w pierwszym (rozgrzewkowym) wywołaniu i średnio w kolejnych.
+ */
+static void report(const std::string &name, int repeats, const std::function<int()> &run) {
+    long before = threadAllocations();
+    int Cmax = run();
+    long warmUp = threadAllocations() - before;
+
+    before = threadAllocations();
+    for (int k = 0; k < repeats; k++) {
+        run();
+    }
+    double perCall = static_cast<double>(threadAllocations() - before) / repeats;
+
+    std::cout << std::setw(26) << name << std::setw(14) << warmUp
+              << std::setw(16) << std::fixed << std::setprecision(2) << perCall
+              << std::setw(12) << Cmax << std::endl;
+}
+
+/**
+ * @brief Benchmark liczby alokacji na stercie: pierwsze wywołanie (rozgrzewka areny) i kolejne wywołania.
+ *
+ * Użycie: bench_allocations [n=10000] [powtórzeń=20]
+ */
+int main(int argc, char **argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 10000;
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    const std::vector<task> tasks = randomTasks(n, 2025);
+    const Instance instance(tasks);
+    const Instance carlierInstance(tightTasks(200, 0.7, 100));
+    const Instance smallInstance(randomTasks(16, 7));
+    const Instance tinyInstance(randomTasks(8, 7));
+
+    ScratchArena arena;
+    std::vector<int> order;
+    std::vector<task> scheduled;
+
+    std::cout << "n = " << n << ", powtórzeń: " << repeats << std::endl;
+    std::cout << std::setw(26) << "algorytm" << std::setw(14) << "rozgrzewka"
+              << std::setw(16) << "na wywołanie" << std::setw(12) << "Cmax" << std::endl;
+
+    report("Schrage (std::vector)", repeats, [&] { return legacySchrage(tasks, scheduled); });
+    report("Schrage", repeats, [&] { return schragePlaning(instance, arena, order); });
+    report("Schrage z wywłaszczeniem", repeats, [&] { return schragePreemptivePlaning(instance, arena); });
+    report("RjSort", repeats, [&] { return rjSortPlaning(instance, arena, order); });
+    report("QjSort", repeats, [&] { return qjSortPlaning(instance, arena, order); });
+    report("WSPT", repeats, [&] { return weightedSPTPlaning(instance, arena, order); });
+    report("Tabu", repeats, [&] { return tabuSearchPlaning(instance, arena, order); });
+    report("Carlier (n=200)", repeats, [&] { return carlierPlaning(carlierInstance, arena, order); });
+    report("DP (n=16)", repeats, [&] { return bitmaskDPPlaning(smallInstance, arena, order); });
+    report("BruteForce (n=8)", repeats, [&] { return bruteForce(tinyInstance, arena, order); });
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "alg_07_tabu.h"
+#include "alg_09_annealing.h"
+#include "bench_common.h"
+#include "cmax_eval.h"
+#include "instrumentation.h"
+#include "lower_bound.h"
+
+/**
+ * @brief Benchmark symulowanego wyżarzania na dużej instancji.
+ *
+ * Dla rosnącej liczby ruchów (każdy przebieg to pełny harmonogram chłodzenia, także po osiągnięciu
+ * dolnego ograniczenia, więc przepustowość liczona jest z faktycznej liczby ruchów) wypisuje czas,
+ * przepustowość w ruchach na sekundę, Cmax i odległość od dolnego ograniczenia. Punktem
+ * odniesienia są Schrage (rozwiązanie startowe) i przeszukiwanie z tabu. W kompilacji z instrumentacją
+ * wiersz zawiera też liczniki mierzonego przebiegu.
+ *
+ * Użycie: bench_annealing [n=100000] [maksymalna_liczba_ruchów=10000000] [okno_r_q=0.7]
+ */
+int main(int argc, char **argv) {
+    const int n = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const long maxMoves = argc > 2 ? std::atol(argv[2]) : 10000000L;
+    const double window = argc > 3 ? std::atof(argv[3]) : 0.7;
+
+    const Instance instance(tightTasks(n, window, 2025));
+    ScratchArena arena;
+    std::vector<int> order;
+
+    const int LB = lowerBounds(instance, arena).best();
+    const int schrage = schragePlaning(instance, arena, order);
+    int tabu = 0;
+    instrumentation::Sample tabuSample;
+    const double tabuSeconds = measureSeconds([&] { tabu = tabuSearchPlaning(instance, arena, order); }, &tabuSample);
+
+    std::cout << "n = " << n << ", okno r/q = " << window << ", dolne ograniczenie: " << LB << std::endl;
+    std::cout << "Schrage: " << schrage << " (LB +" << std::fixed << std::setprecision(3)
+              << optimalityGap(schrage, LB) << "%)" << std::endl;
+    std::cout << "Tabu:    " << tabu << " (LB +" << optimalityGap(tabu, LB) << "%), " << tabuSeconds << " s"
+              << instrumentation::tableColumn(tabuSample) << std::endl << std::endl;
+
+    std::cout << std::setw(12) << "ruchów" << std::setw(12) << "czas [s]" << std::setw(14) << "ruchów/s"
+              << std::setw(12) << "Cmax" << std::setw(12) << "Cmax - LB" << std::setw(12) << "LB+ [%]"
+              << instrumentation::tableHeader() << std::endl;
+
+    bool ok = true;
+    for (long moves = 10000; moves <= maxMoves; moves *= 10) {
+        AnnealingOptions options;
+        options.maxMoves = moves;
+        options.stopAtLowerBound = false;
+        int Cmax = 0;
+        instrumentation::Sample sample;
+        const double seconds = measureSeconds([&] { Cmax = simulatedAnnealingPlaning(instance, arena, order, options); },
+                                              &sample);
+        if (evaluateCmax(instance, order.data()) != Cmax) {
+            std::cerr << "NIEZGODNOŚĆ: zwrócony Cmax " << Cmax << " a permutacja "
+                      << evaluateCmax(instance, order.data()) << std::endl;
+            ok = false;
+        }
+        std::cout << std::setw(12) << moves << std::setw(12) << std::setprecision(3) << seconds
+                  << std::setw(14) << std::setprecision(0) << moves / seconds
+                  << std::setw(12) << Cmax << std::setw(12) << Cmax - LB << std::setw(12) << std::setprecision(4)
+                  << optimalityGap(Cmax, LB)
+                  << instrumentation::tableColumn(sample) << std::endl;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include "alg_04_carlier.h"
+#include "alg_05_carlier_parallel.h"
+#include "bench_common.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Benchmark przyspieszenia wielowątkowego algorytmu Carliera względem liczby wątków.
+ *
+ * Dla każdej liczby wątków (1, 2, 4, ... do maksymalnej) rozwiązywany jest ten sam zestaw
+ * instancji z ciasnymi oknami r/q; wynik jest porównywany z sekwencyjnym algorytmem Carliera.
+ * W kompilacji z instrumentacją wiersz zawiera też liczniki całego zestawu (tylko wątku wywołującego).
+ *
+ * Użycie: bench_carlier_parallel [n] [maks_wątków] [liczba_instancji]
+ */
+int main(int argc, char **argv) {
+    int n = argc > 1 ? std::atoi(argv[1]) : 800;
+    int maxThreads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int instanceCount = argc > 3 ? std::atoi(argv[3]) : 6;
+
+    std::vector<Instance> instances;
+    std::vector<int> optimum;
+    for (int k = 0; k < instanceCount; k++) {
+        instances.emplace_back(tightTasks(n, 0.7, 100 + k));
+    }
+
+    ScratchArena arena;
+    std::vector<int> order;
+    instrumentation::Sample sequentialSample;
+    double sequentialSeconds = measureSeconds([&] {
+        for (const auto &instance: instances) {
+            optimum.push_back(carlierPlaning(instance, arena, order));
+        }
+    }, &sequentialSample);
+
+    std::cout << "n = " << n << ", instancji: " << instanceCount << std::endl;
+    std::cout << "Carlier sekwencyjny: " << std::fixed << std::setprecision(2) << sequentialSeconds * 1e3 << " ms"
+              << instrumentation::tableColumn(sequentialSample) << std::endl;
+    std::cout << std::setw(8) << "wątki" << std::setw(14) << "czas [ms]" << std::setw(14) << "przysp."
+              << instrumentation::tableHeader() << std::endl;
+
+    double singleThreadSeconds = 0.0;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        bool correct = true;
+        instrumentation::Sample sample;
+        double seconds = measureSeconds([&] {
+            for (size_t k = 0; k < instances.size(); k++) {
+                correct &= carlierParallelPlaning(instances[k], order, threads) == optimum[k];
+            }
+        }, &sample);
+        if (threads == 1) {
+            singleThreadSeconds = seconds;
+        }
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(14) << std::setprecision(2) << seconds * 1e3
+                  << std::setw(14) << std::setprecision(2) << singleThreadSeconds / seconds
+                  << (correct ? "" : "  BŁĄD: wynik różny od sekwencyjnego")
+                  << instrumentation::tableColumn(sample) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include "bench_common.h"
+#include "cmax_eval.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Mikrobenchmark wsadowej oceny Cmax: kandydaci na sekundę dla pętli skalarnej
+ * (evaluateCmax wywoływane osobno dla każdego kandydata) oraz dla wariantów evaluateCmaxBatch.
+ * W kompilacji z instrumentacją wiersz zawiera też liczniki całej mierzonej pętli powtórzeń.
+ *
+ * Użycie: bench_cmax_batch [liczba_kandydatów]
+ */
+int main(int argc, char **argv) {
+    int count = argc > 1 ? std::atoi(argv[1]) : 4096;
+
+    for (int n: {20, 100, 1000}) {
+        const Instance instance(randomTasks(n, 7));
+
+        // Losowe permutacje kandydatów zapisane jedna po drugiej
+        std::mt19937 gen(11);
+        std::vector<int> permutations(static_cast<size_t>(count) * n);
+        std::vector<int> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        for (int c = 0; c < count; c++) {
+            std::shuffle(order.begin(), order.end(), gen);
+            std::copy(order.begin(), order.end(), permutations.begin() + static_cast<size_t>(c) * n);
+        }
+
+        std::vector<int> expected(count);
+        int repeats = std::max(1, 2000000 / (count * n));
+        instrumentation::Sample scalarSample;
+        double scalarSeconds = measureSeconds([&] {
+            for (int k = 0; k < repeats; k++) {
+                for (int c = 0; c < count; c++) {
+                    expected[c] = evaluateCmax(instance, permutations.data() + static_cast<size_t>(c) * n);
+                }
+            }
+        }, &scalarSample) / repeats;
+
+        std::cout << "n = " << n << ", kandydatów: " << count << std::endl;
+        std::cout << std::setw(22) << "pętla skalarna" << std::setw(16) << std::fixed << std::setprecision(0)
+                  << count / scalarSeconds << " kand./s" << instrumentation::tableColumn(scalarSample) << std::endl;
+
+        for (BatchKernel kernel: {BatchKernel::Scalar, BatchKernel::AVX2, BatchKernel::AVX512}) {
+            if (!batchKernelSupported(kernel)) {
+                std::cout << std::setw(22) << batchKernelName(kernel) << "   niedostępny" << std::endl;
+                continue;
+            }
+
+            std::vector<int> results(count);
+            instrumentation::Sample sample;
+            double seconds = measureSeconds([&] {
+                for (int k = 0; k < repeats; k++) {
+                    evaluateCmaxBatch(instance, permutations.data(), count, results.data(), kernel);
+                }
+            }, &sample) / repeats;
+
+            std::cout << std::setw(22) << batchKernelName(kernel) << std::setw(16) << std::setprecision(0) << count / seconds
+                      << " kand./s" << std::setw(10) << std::setprecision(2) << scalarSeconds / seconds << "x"
+                      << (results == expected ? "" : "  BŁĄD: wyniki różne od pętli skalarnej")
+                      << instrumentation::tableColumn(sample) << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "instrumentation.h"
+#include "task_struct.h"
+
+/**
+ * @brief Generuje losową instancję problemu 1|r_j,q_j|Cmax.
+ *
+ * Rozkład jest zbliżony do plików SCHRAGE*.dat: p z przedziału [1, 100],
+ * a r i q rozłożone na przedziale rzędu sumy czasów przetwarzania.
+ *
+ * @param n Liczba zadań.
+ * @param seed Ziarno generatora (ta sama wartość daje tę samą instancję).
+ * @return Wektor zadań o identyfikatorach 1..n.
+ */
+inline std::vector<task> randomTasks(int n, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> distP(1, 100);
+    std::uniform_int_distribution<int> distRQ(1, 50 * n);
+
+    std::vector<task> tasks(n);
+    for (int i = 0; i < n; i++) {
+        tasks[i].id = i + 1;
+        tasks[i].r = distRQ(gen);
+        tasks[i].p = distP(gen);
+        tasks[i].q = distRQ(gen);
+    }
+    return tasks;
+}
+
+/**
+ * @brief Generuje instancję z ciasnymi oknami r/q, trudną dla algorytmów podziału i ograniczeń.
+ *
+ * r i q są losowane z przedziału [1, window * suma p]; dla window w okolicy 0.6-0.9
+ * drzewo algorytmu Carliera jest wielokrotnie głębsze niż dla rozkładu z randomTasks.
+ *
+ * @param n Liczba zadań.
+ * @param window Szerokość okna r/q jako ułamek sumy czasów przetwarzania.
+ * @param seed Ziarno generatora.
+ * @return Wektor zadań o identyfikatorach 1..n.
+ */
+inline std::vector<task> tightTasks(int n, double window, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> distP(1, 100);
+
+    std::vector<task> tasks(n);
+    long sumP = 0;
+    for (int i = 0; i < n; i++) {
+        tasks[i].id = i + 1;
+        tasks[i].p = distP(gen);
+        sumP += tasks[i].p;
+    }
+
+    std::uniform_int_distribution<int> distRQ(1, std::max(1, static_cast<int>(window * sumP)));
+    for (auto &t: tasks) {
+        t.r = distRQ(gen);
+        t.q = distRQ(gen);
+    }
+    return tasks;
+}
+
+/**
+ * @brief Mierzy czas wykonania funkcji w sekundach.
+ *
+ * @param func Funkcja do wykonania.
+ * @param sample Jeśli podany - liczniki instrumentacji tego wykonania (puste bez INSTRUMENTATION=ON);
+ * liczniki perf są włączane i odczytywane poza mierzonym czasem.
+ * @return Czas wykonania w sekundach.
+ */
+template<typename Func>
+double measureSeconds(Func &&func, instrumentation::Sample *sample = nullptr) {
+    instrumentation::Probe probe(sample != nullptr);
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    if (sample) {
+        *sample = probe.finish();
+    }
+    return std::chrono::duration<double>(end - start).count();
+}
+
+#endif //BENCH_COMMON_H
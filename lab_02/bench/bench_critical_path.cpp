@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "allocation_counter.h"
+#include "bench_common.h"
+#include "benchmark.h"
+#include "cmax_eval.h"
+#include "critical_path.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Sprawdza wynik analyzeSchedule: Cmax, head + p + tail <= Cmax i równość na pozycji b.
+ */
+static bool consistent(const Instance &instance, const int *order, const CriticalPath &path,
+                       const std::vector<int> &head, const std::vector<int> &tail) {
+    if (path.Cmax != evaluateCmax(instance, order)) {
+        return false;
+    }
+    for (int k = 0; k < instance.size(); k++) {
+        if (head[k] + instance.p()[order[k]] + tail[k] > path.Cmax) {
+            return false;
+        }
+    }
+    return head[path.b] + instance.p()[order[path.b]] + tail[path.b] == path.Cmax &&
+           head[path.a] == instance.r()[order[path.a]];
+}
+
+/**
+ * @brief Benchmark analizy ścieżki krytycznej (analyzeSchedule) na permutacjach Schrage i losowych.
+ *
+ * Punktem odniesienia jest samo obliczenie Cmax (evaluateCmax). Mierzone są: analiza bez tablic
+ * wyjściowych, z tablicą momentów rozpoczęcia oraz z momentami rozpoczęcia i ogonami. Kolumna
+ * "alokacje" potwierdza, że analiza nie przydziela pamięci. W kompilacji z instrumentacją wiersz zawiera
+ * też liczniki pierwszego przebiegu runBenchmark.
+ *
+ * Użycie: bench_critical_path [n=1000000]
+ */
+int main(int argc, char **argv) {
+    const int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    const Instance instance(randomTasks(n, 2025));
+
+    ScratchArena arena;
+    std::vector<int> schrage;
+    schragePlaning(instance, arena, schrage);
+    std::vector<int> shuffled(n);
+    std::iota(shuffled.begin(), shuffled.end(), 0);
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+
+    std::vector<int> head(n), tail(n);
+    std::cout << "n = " << n << std::endl;
+    std::cout << std::setw(12) << "permutacja" << std::setw(30) << "wariant" << std::setw(14) << "mediana [ms]"
+              << std::setw(12) << "ns/zadanie" << std::setw(11) << "alokacje"
+              << instrumentation::tableHeader() << std::endl;
+
+    bool ok = true;
+    for (const auto &[name, order]: {std::pair<const char *, const std::vector<int> *>{"Schrage", &schrage},
+                                     {"losowa", &shuffled}}) {
+        const int *perm = order->data();
+        const CriticalPath path = analyzeSchedule(instance, perm, head.data(), tail.data());
+        if (!consistent(instance, perm, path, head, tail)) {
+            std::cerr << "NIEZGODNOŚĆ analizy dla permutacji " << name << std::endl;
+            ok = false;
+        }
+
+        auto row = [&](const char *variant, auto &&run) {
+            // Alokacje liczone dla pojedynczego wywołania (runBenchmark sam przydziela pamięć na próbki)
+            const long before = threadAllocations();
+            doNotOptimize(run());
+            const long allocations = threadAllocations() - before;
+            const BenchmarkStats stats = runBenchmark(run);
+            std::cout << std::setw(12) << name << std::setw(30) << variant << std::fixed << std::setprecision(3)
+                      << std::setw(14) << stats.median * 1e3 << std::setw(12) << std::setprecision(2)
+                      << stats.median * 1e9 / n << std::setw(11) << allocations
+                      << instrumentation::tableColumn(stats.sample) << std::endl;
+        };
+        row("evaluateCmax", [&] { return evaluateCmax(instance, perm); });
+        row("analyzeSchedule", [&] { return analyzeSchedule(instance, perm).c; });
+        row("analyzeSchedule + head", [&] { return analyzeSchedule(instance, perm, head.data()).c; });
+        row("analyzeSchedule + head/tail", [&] {
+            return analyzeSchedule(instance, perm, head.data(), tail.data()).c;
+        });
+        std::cout << std::setw(12) << "" << "  Cmax " << path.Cmax << ", blok " << path.a << ".." << path.b
+                  << ", c = " << path.c << std::endl;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "alg_01_schrage.h"
+#include "bench_common.h"
+#include "instance_io.h"
+
+/**
+ * @brief Czasy pojedynczych operacji dyspozytora zebrane podczas odtwarzania strumienia zdarzeń.
+ */
+struct ReplayResult {
+    std::vector<long> submitNs;   ///< advance() + submit() dla każdego nadejścia zadania
+    std::vector<long> nextNs;     ///< next() dla każdej decyzji
+    std::vector<int> order;       ///< Indeksy zadań w kolejności uruchomienia
+    int Cmax = 0;
+};
+
+/**
+ * @brief Odtwarza instancję jako strumień zdarzeń: zadania nadchodzą w chwilach r, a maszyna
+ * prosi o decyzję za każdym razem, gdy się zwalnia.
+ */
+static ReplayResult replay(const std::vector<task> &tasks) {
+    const size_t n = tasks.size();
+
+    // Strumień nadejść - zadania w kolejności r (przy remisie według indeksu)
+    std::vector<int> arrivals(n);
+    for (size_t i = 0; i < n; i++) {
+        arrivals[i] = static_cast<int>(i);
+    }
+    std::stable_sort(arrivals.begin(), arrivals.end(), [&](int a, int b) { return tasks[a].r < tasks[b].r; });
+
+    ReplayResult result;
+    result.submitNs.reserve(n);
+    result.nextNs.reserve(n);
+    result.order.reserve(n);
+
+    SchrageDispatcher dispatcher;
+    dispatcher.reserve(n);
+
+    size_t k = 0;
+    while (k < n || dispatcher.size() > 0) {
+        // Zadania, które nadeszły do chwili decyzji, muszą zostać zgłoszone przed nią
+        if (k < n && tasks[arrivals[k]].r <= dispatcher.time()) {
+            task job = tasks[arrivals[k]];
+            job.id = arrivals[k];
+            auto start = std::chrono::steady_clock::now();
+            dispatcher.advance(job.r);
+            dispatcher.submit(job);
+            auto end = std::chrono::steady_clock::now();
+            result.submitNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            k++;
+            continue;
+        }
+
+        if (dispatcher.readyCount() == 0) {
+            // Maszyna bezczynna - czekamy na następne nadejście
+            dispatcher.advance(std::min(tasks[arrivals[k]].r, dispatcher.nextRelease()));
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        std::optional<task> job = dispatcher.next();
+        auto end = std::chrono::steady_clock::now();
+        result.nextNs.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        result.order.push_back(job->id);
+    }
+
+    result.Cmax = dispatcher.cmax();
+    return result;
+}
+
+/**
+ * @brief Wypisuje percentyle czasu operacji
+ */
+static void printPercentiles(const std::string &name, std::vector<long> samples) {
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&](double fraction) {
+        return samples[std::min(samples.size() - 1, static_cast<size_t>(fraction * samples.size()))];
+    };
+    std::cout << std::setw(20) << name << std::setw(10) << samples.size()
+              << std::setw(10) << percentile(0.5) << std::setw(10) << percentile(0.9)
+              << std::setw(10) << percentile(0.99) << std::setw(10) << percentile(0.999)
+              << std::setw(10) << samples.back() << std::endl;
+}
+
+/**
+ * @brief Odtwarza instancję, sprawdza zgodność z schragePlaning i wypisuje opóźnienia operacji.
+ * @return false, jeśli decyzje dyspozytora różnią się od algorytmu wsadowego
+ */
+static bool runInstance(const std::string &name, const std::vector<task> &tasks) {
+    ReplayResult result = replay(tasks);
+
+    const Instance instance(tasks);
+    ScratchArena arena;
+    std::vector<int> order;
+    const int Cmax = schragePlaning(instance, arena, order);
+
+    std::cout << name << ": n = " << tasks.size() << ", Cmax = " << result.Cmax << std::endl;
+    if (Cmax != result.Cmax || order != result.order) {
+        std::cout << "NIEZGODNOŚĆ z schragePlaning (Cmax " << Cmax << ")" << std::endl;
+        return false;
+    }
+
+    std::cout << std::setw(20) << "operacja [ns]" << std::setw(10) << "liczba" << std::setw(10) << "p50"
+              << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(10) << "max" << std::endl;
+    printPercentiles("advance + submit", result.submitNs);
+    printPercentiles("next", result.nextNs);
+    std::cout << std::endl;
+    return true;
+}
+
+/**
+ * @brief Benchmark dyspozytora Schrage online: odtwarza plik SCHRAGE jako strumień zdarzeń
+ * oraz dużą instancję losową i mierzy percentyle opóźnienia pojedynczych zdarzeń.
+ *
+ * Użycie: bench_dispatcher [plik=data/SCHRAGE9.dat] [n_losowej=1000000]
+ */
+int main(int argc, char **argv) {
+    std::string path = argc > 1 ? argv[1] : "data/SCHRAGE9.dat";
+    int n = argc > 2 ? std::atoi(argv[2]) : 1000000;
+
+    LoadResult loaded = loadInstance(path);
+    if (!loaded) {
+        std::cerr << loaded.error << std::endl;
+        return 1;
+    }
+
+    bool ok = runInstance(path, loaded.instance.toTasks());
+    ok = runInstance("losowa", randomTasks(n, 2025)) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "alg_10_genetic.h"
+#include "bench_common.h"
+#include "cmax_eval.h"
+#include "instrumentation.h"
+#include "lower_bound.h"
+
+/**
+ * @brief Sprawdza, czy order jest permutacją 0..n-1 o podanym Cmax.
+ */
+static bool validSolution(const Instance &instance, const std::vector<int> &order, int Cmax) {
+    std::vector<char> seen(instance.size(), 0);
+    for (int j: order) {
+        if (j < 0 || j >= instance.size() || seen[j]) {
+            return false;
+        }
+        seen[j] = 1;
+    }
+    return static_cast<int>(order.size()) == instance.size() && evaluateCmax(instance, order.data()) == Cmax;
+}
+
+/**
+ * @brief Benchmark algorytmu genetycznego z modelem wysp.
+ *
+ * Dla instancji 100 i 1000 zadań oraz krzyżowania OX i PMX wypisuje, dla 1..N wątków (po jednej
+ * wyspie na wątek), czas, łączną liczbę pokoleń na sekundę (suma po wyspach), przyspieszenie
+ * przepustowości względem jednego wątku oraz Cmax i odległość od dolnego ograniczenia. Wyspy nie kończą
+ * po osiągnięciu dolnego ograniczenia, więc każda wykonuje pełną liczbę pokoleń. W kompilacji
+ * z instrumentacją wiersz zawiera też liczniki przebiegu (tylko wątku wywołującego).
+ *
+ * Użycie: bench_genetic [pokoleń=200] [maksymalna_liczba_wątków=liczba rdzeni]
+ */
+int main(int argc, char **argv) {
+    const int generations = argc > 1 ? std::atoi(argv[1]) : 200;
+    const int maxThreads = argc > 2 ? std::atoi(argv[2])
+                                    : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    std::cout << std::setw(6) << "n" << std::setw(6) << "op" << std::setw(8) << "wątki" << std::setw(12) << "czas [s]"
+              << std::setw(14) << "pokoleń/s" << std::setw(12) << "skalowanie" << std::setw(10) << "Cmax"
+              << std::setw(10) << "LB+ [%]" << instrumentation::tableHeader() << std::endl;
+
+    bool ok = true;
+    ScratchArena arena;
+    std::vector<int> order;
+    for (int n: {100, 1000}) {
+        const Instance instance(tightTasks(n, 0.7, 2025));
+        const int LB = lowerBounds(instance, arena).best();
+        for (Crossover crossover: {Crossover::OX, Crossover::PMX}) {
+            double single = 0;
+            for (int threads = 1; threads <= maxThreads; threads *= 2) {
+                GeneticOptions options;
+                options.islands = threads;
+                options.generations = generations;
+                options.crossover = crossover;
+                options.stopAtLowerBound = false;
+                int Cmax = 0;
+                instrumentation::Sample sample;
+                const double seconds = measureSeconds([&] { Cmax = geneticPlaning(instance, order, options); },
+                                                      &sample);
+                if (!validSolution(instance, order, Cmax)) {
+                    std::cerr << "NIEPOPRAWNE rozwiązanie dla n = " << n << ", wątków: " << threads << std::endl;
+                    ok = false;
+                }
+
+                const double rate = static_cast<double>(threads) * generations / seconds;
+                if (threads == 1) {
+                    single = rate;
+                }
+                std::cout << std::setw(6) << n << std::setw(6) << (crossover == Crossover::OX ? "OX" : "PMX")
+                          << std::setw(8) << threads << std::fixed << std::setprecision(3) << std::setw(12) << seconds
+                          << std::setw(14) << std::setprecision(0) << rate
+                          << std::setw(11) << std::setprecision(2) << rate / single << "x"
+                          << std::setw(10) << Cmax << std::setw(10) << std::setprecision(3) << optimalityGap(Cmax, LB)
+                          << instrumentation::tableColumn(sample) << std::endl;
+            }
+        }
+    }
+    return ok ? 0 : 1;
+}
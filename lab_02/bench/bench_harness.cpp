@@ -0,0 +1,126 @@
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "algorithm_registry.h"
+#include "bench_common.h"
+#include "benchmark.h"
+#include "instrumentation.h"
+#include "lower_bound.h"
+
+/**
+ * @brief Dzieli listę rozdzieloną przecinkami
+ */
+static std::vector<std::string> splitList(const std::string &text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        items.push_back(item);
+    }
+    return items;
+}
+
+/**
+ * @brief Wspólny benchmark wszystkich algorytmów z algorithm_registry dla kolejnych rozmiarów instancji.
+ *
+ * Dla każdej pary (algorytm, n) mierzy czas na losowej instancji: rozgrzewka, powtórzenia aż do
+ * wyczerpania budżetu, min/mediana/p99, przepustowość (zadania na sekundę dla mediany) oraz
+ * odległość wyniku od dolnego ograniczenia instancji.
+ * W kompilacji z instrumentacją (INSTRUMENTATION=ON) wiersz zawiera też liczniki pierwszego przebiegu
+ * runBenchmark: zdarzenia, czasy faz i liczniki sprzętowe.
+ * Pary, w których n przekracza limit algorytmu, są pomijane.
+ *
+ * Użycie: bench_harness [--sizes 10,100,...] [--algorithms a,b,...] [--cpu N] [--budget ms] [--csv]
+ */
+int main(int argc, char **argv) {
+    std::vector<int> sizes = {10, 100, 1000, 10000, 100000};
+    std::vector<const AlgorithmInfo *> selected;
+    BenchmarkOptions options;
+    bool csv = false;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--sizes") == 0 && hasValue) {
+            sizes.clear();
+            for (const std::string &size: splitList(argv[++i])) {
+                sizes.push_back(std::atoi(size.c_str()));
+            }
+        } else if (std::strcmp(argv[i], "--algorithms") == 0 && hasValue) {
+            for (const std::string &name: splitList(argv[++i])) {
+                const AlgorithmInfo *algorithm = findAlgorithm(name);
+                if (!algorithm) {
+                    std::cerr << "Nieznany algorytm: " << name << std::endl;
+                    return 1;
+                }
+                selected.push_back(algorithm);
+            }
+        } else if (std::strcmp(argv[i], "--cpu") == 0 && hasValue) {
+            const int cpu = std::atoi(argv[++i]);
+            if (!pinCurrentThread(cpu)) {
+                std::cerr << "Nie można przypiąć wątku do procesora " << cpu << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--budget") == 0 && hasValue) {
+            options.budgetSeconds = std::atof(argv[++i]) / 1e3;
+        } else if (std::strcmp(argv[i], "--csv") == 0) {
+            csv = true;
+        } else {
+            std::cerr << "Użycie: " << argv[0]
+                      << " [--sizes 10,100,...] [--algorithms a,b,...] [--cpu N] [--budget ms] [--csv]" << std::endl;
+            return 1;
+        }
+    }
+    if (selected.empty()) {
+        for (const AlgorithmInfo &algorithm: algorithms()) {
+            selected.push_back(&algorithm);
+        }
+    }
+
+    if (csv) {
+        std::cout << "algorithm,n,runs,min_us,median_us,p99_us,mean_us,tasks_per_second,lb_gap_percent"
+                  << (instrumentation::ENABLED ? instrumentation::csvHeader() : "") << std::endl;
+    } else {
+        std::cout << std::setw(22) << "algorytm" << std::setw(9) << "n" << std::setw(9) << "przebiegi"
+                  << std::setw(13) << "min [us]" << std::setw(13) << "mediana [us]" << std::setw(13) << "p99 [us]"
+                  << std::setw(15) << "zadań/s" << std::setw(12) << "LB +[%]"
+                  << instrumentation::tableHeader() << std::endl;
+    }
+
+    ScratchArena arena;
+    std::vector<int> order;
+    for (int n: sizes) {
+        const Instance instance(randomTasks(n, 2025));
+        const int lowerBound = lowerBounds(instance, arena).best();
+        for (const AlgorithmInfo *algorithm: selected) {
+            if (n > algorithm->maxTasks) {
+                continue;
+            }
+
+            int Cmax = 0;
+            BenchmarkStats stats = runBenchmark([&] { return Cmax = algorithm->run(instance, arena, order); }, options);
+            const double throughput = stats.median > 0 ? n / stats.median : 0;
+            const double gap = optimalityGap(Cmax, lowerBound);
+
+            if (csv) {
+                std::cout << algorithm->name << ',' << n << ',' << stats.runs << std::fixed << std::setprecision(3)
+                          << ',' << stats.min * 1e6 << ',' << stats.median * 1e6 << ',' << stats.p99 * 1e6
+                          << ',' << stats.mean * 1e6 << ',' << std::setprecision(0) << throughput
+                          << ',' << std::setprecision(3) << gap
+                          << (instrumentation::ENABLED ? instrumentation::csvRow(stats.sample) : "") << std::endl;
+            } else {
+                std::cout << std::setw(22) << algorithm->name << std::setw(9) << n << std::setw(9) << stats.runs
+                          << std::fixed << std::setprecision(2) << std::setw(13) << stats.min * 1e6
+                          << std::setw(13) << stats.median * 1e6 << std::setw(13) << stats.p99 * 1e6
+                          << std::setw(15) << std::setprecision(0) << throughput
+                          << std::setw(12) << std::setprecision(3) << gap
+                          << instrumentation::tableColumn(stats.sample) << std::endl;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "bench_common.h"
+#include "instance_io.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Dawny sposób wczytywania (std::ifstream i operator >>) - punkt odniesienia.
+ */
+static std::vector<task> legacyLoad(const std::string &path) {
+    std::ifstream file(path);
+    int n = 0;
+    file >> n;
+    std::vector<task> tasks(n);
+    for (int i = 0; i < n; i++) {
+        file >> tasks[i].r >> tasks[i].p >> tasks[i].q;
+        tasks[i].id = i + 1;
+    }
+    return tasks;
+}
+
+/**
+ * @brief Zapisuje instancję w formacie SCHRAGE*.dat
+ * @return Rozmiar pliku w bajtach
+ */
+static size_t writeDat(const std::string &path, const std::vector<task> &tasks) {
+    std::ofstream file(path);
+    file << tasks.size() << "\n";
+    for (const task &t: tasks) {
+        file << t.r << " " << t.p << " " << t.q << "\n";
+    }
+    return static_cast<size_t>(file.tellp());
+}
+
+/**
+ * @brief Sprawdza, czy instancja zawiera te same dane co wektor zadań
+ */
+static bool sameData(const Instance &instance, const std::vector<task> &tasks) {
+    for (int i = 0; i < instance.size(); i++) {
+        if (instance.r()[i] != tasks[i].r || instance.p()[i] != tasks[i].p || instance.q()[i] != tasks[i].q) {
+            std::cerr << "NIEZGODNOŚĆ danych zadania " << i + 1 << std::endl;
+            return false;
+        }
+    }
+    return instance.size() == static_cast<int>(tasks.size());
+}
+
+/**
+ * @brief Benchmark wczytywania instancji: std::ifstream, mmap + std::from_chars oraz format binarny.
+ *
+ * Dla każdego rozmiaru zapisuje pliki tymczasowe .dat i .bin, wczytuje je (najlepszy z trzech
+ * pomiarów) i sprawdza zgodność danych. Format binarny mierzony jest dwukrotnie: samo
+ * odwzorowanie (instancja gotowa do użycia) oraz odwzorowanie z jednokrotnym odczytem wszystkich kolumn.
+ * W kompilacji z instrumentacją pod wierszem wypisywane są liczniki najszybszego pomiaru każdego sposobu.
+ *
+ * Użycie: bench_loader [maksymalne_n=1000000]
+ */
+int main(int argc, char **argv) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 1000000L;
+    const std::string textPath = "bench_loader.tmp.dat", binaryPath = "bench_loader.tmp.bin";
+
+    std::cout << std::setw(10) << "n" << std::setw(10) << "MB" << std::setw(16) << "ifstream [ms]"
+              << std::setw(16) << "from_chars [ms]" << std::setw(12) << "MB/s" << std::setw(16) << "binarny [ms]"
+              << std::setw(22) << "binarny+odczyt [ms]" << std::endl;
+
+    bool ok = true;
+    for (long n = 1000; n <= maxN && ok; n *= 10) {
+        const std::vector<task> tasks = randomTasks(static_cast<int>(n), 2025);
+        const double megabytes = writeDat(textPath, tasks) / 1e6;
+        const std::string error = saveBinaryInstance(Instance(tasks), binaryPath);
+        if (!error.empty()) {
+            std::cerr << error << std::endl;
+            ok = false;
+            break;
+        }
+
+        double legacySeconds = 1e30, textSeconds = 1e30, binarySeconds = 1e30, touchSeconds = 1e30;
+        instrumentation::Sample legacySample, textSample, binarySample, touchSample;
+        // Zapamiętuje czas i liczniki pomiaru, jeśli był najszybszy
+        auto measureBest = [](double &best, instrumentation::Sample &bestSample, auto &&func) {
+            instrumentation::Sample sample;
+            const double seconds = measureSeconds(func, &sample);
+            if (seconds < best) {
+                best = seconds;
+                bestSample = sample;
+            }
+        };
+        std::vector<task> legacy;
+        LoadResult text, binary;
+        volatile long checksum = 0;
+        for (int k = 0; k < 3; k++) {
+            measureBest(legacySeconds, legacySample, [&] { legacy = legacyLoad(textPath); });
+            measureBest(textSeconds, textSample, [&] { text = loadInstance(textPath); });
+            measureBest(binarySeconds, binarySample, [&] { binary = loadInstance(binaryPath); });
+            measureBest(touchSeconds, touchSample, [&] {
+                LoadResult touched = loadInstance(binaryPath);
+                long sum = 0;
+                for (int i = 0; i < touched.instance.size(); i++) {
+                    sum += touched.instance.r()[i] + touched.instance.p()[i] + touched.instance.q()[i];
+                }
+                checksum = sum;
+            });
+        }
+
+        if (!text || !binary) {
+            std::cerr << (text ? binary.error : text.error) << std::endl;
+            ok = false;
+            break;
+        }
+        ok = sameData(text.instance, legacy) && sameData(binary.instance, legacy);
+
+        std::cout << std::setw(10) << n << std::setw(10) << std::fixed << std::setprecision(1) << megabytes
+                  << std::setw(16) << std::setprecision(3) << legacySeconds * 1e3
+                  << std::setw(16) << textSeconds * 1e3
+                  << std::setw(12) << std::setprecision(1) << megabytes / textSeconds
+                  << std::setw(16) << std::setprecision(3) << binarySeconds * 1e3
+                  << std::setw(22) << touchSeconds * 1e3 << std::endl;
+        if (instrumentation::ENABLED) {
+            std::cout << std::setw(10) << "" << "  ifstream:       " << instrumentation::describe(legacySample) << std::endl
+                      << std::setw(10) << "" << "  from_chars:     " << instrumentation::describe(textSample) << std::endl
+                      << std::setw(10) << "" << "  binarny:        " << instrumentation::describe(binarySample) << std::endl
+                      << std::setw(10) << "" << "  binarny+odczyt: " << instrumentation::describe(touchSample)
+                      << std::endl;
+        }
+    }
+
+    std::remove(textPath.c_str());
+    std::remove(binaryPath.c_str());
+    return ok ? 0 : 1;
+}
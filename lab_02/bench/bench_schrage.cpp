@@ -0,0 +1,50 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "alg_01_schrage.h"
+#include "bench_common.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Benchmark skalowania algorytmu Schrage od rozmiaru SCHRAGE9 (10^3) do 10^7 zadań.
+ *
+ * W kompilacji z instrumentacją wiersz zawiera liczniki jednego dodatkowego przebiegu (bez instrumentacji
+ * ten przebieg jest pomijany).
+ *
+ * Użycie: bench_schrage [maksymalne_n]
+ */
+int main(int argc, char **argv) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 10000000L;
+
+    std::cout << std::setw(10) << "n" << std::setw(14) << "czas [ms]"
+              << std::setw(14) << "ns/zadanie" << std::setw(16) << "Cmax"
+              << instrumentation::tableHeader() << std::endl;
+
+    for (long n = 1000; n <= maxN; n *= 10) {
+        const Instance instance(randomTasks(static_cast<int>(n), 2025));
+        ScratchArena arena;
+
+        // Mniejsze instancje powtarzamy, żeby pomiar nie był szumem
+        int repeats = static_cast<int>(std::max(1L, 1000000L / n));
+        int Cmax = 0;
+        double seconds = measureSeconds([&] {
+            for (int k = 0; k < repeats; k++) {
+                Cmax = schragePlaning(instance, arena, nullptr);
+            }
+        }) / repeats;
+
+        // Liczniki z jednego przebiegu, a nie sumy po powtórzeniach
+        instrumentation::Sample sample;
+        if (instrumentation::ENABLED) {
+            measureSeconds([&] { schragePlaning(instance, arena, nullptr); }, &sample);
+        }
+
+        std::cout << std::setw(10) << n
+                  << std::setw(14) << std::fixed << std::setprecision(3) << seconds * 1e3
+                  << std::setw(14) << std::setprecision(1) << seconds * 1e9 / n
+                  << std::setw(16) << Cmax
+                  << instrumentation::tableColumn(sample) << std::endl;
+    }
+
+    return 0;
+}
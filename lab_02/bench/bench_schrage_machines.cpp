@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "bench_common.h"
+#include "benchmark.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Odtwarza przydział na maszynach (start = max(zwolnienie maszyny, r)) i zwraca Cmax.
+ */
+static int replay(const Instance &instance, int machines, const std::vector<int> &order,
+                  const std::vector<int> &machineOf) {
+    std::vector<int> freeAt(machines, 0);
+    int Cmax = 0;
+    for (size_t k = 0; k < order.size(); k++) {
+        const int j = order[k];
+        int &machine = freeAt[machineOf[k]];
+        machine = std::max(machine, instance.r()[j]) + instance.p()[j];
+        Cmax = std::max(Cmax, machine + instance.q()[j]);
+    }
+    return Cmax;
+}
+
+/**
+ * @brief Benchmark algorytmu Schrage dla m maszyn równoległych (P|r_j,q_j|Cmax).
+ *
+ * Dla n = 10^3..nMax i m = 1, 2, 4, ..., 64 mierzona jest mediana czasu schrageMachinesPlaning;
+ * koszt O(n log n + n log m) powinien dawać prawie stałą liczbę ns na zadanie przy rosnącym m.
+ * Dla m = 1 wynik porównywany jest z schragePlaning (oba warianty korzystają z tego samego rdzenia
+ * ReadyQueue, więc to test regresji trybu wielu maszyn), a dla każdego m przydział odtwarzany jest
+ * niezależnie i porównywany z zwróconym Cmax. W kompilacji z instrumentacją wiersz zawiera też liczniki
+ * pierwszego przebiegu runBenchmark.
+ *
+ * Użycie: bench_schrage_machines [nMax=1000000]
+ */
+int main(int argc, char **argv) {
+    const int nMax = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    std::cout << std::setw(10) << "n" << std::setw(6) << "m" << std::setw(14) << "Cmax" << std::setw(14)
+              << "mediana [ms]" << std::setw(12) << "ns/zadanie"
+              << instrumentation::tableHeader() << std::endl;
+
+    bool ok = true;
+    ScratchArena arena;
+    std::vector<int> order, machineOf, single;
+    for (int n = 1000; n <= nMax; n *= 10) {
+        const Instance instance(randomTasks(n, 2025));
+
+        const int schrage = schragePlaning(instance, arena, single);
+        for (int m = 1; m <= 64; m *= 2) {
+            const int Cmax = schrageMachinesPlaning(instance, arena, m, order, machineOf);
+            if (replay(instance, m, order, machineOf) != Cmax) {
+                std::cerr << "NIEZGODNOŚĆ przydziału dla n = " << n << ", m = " << m << std::endl;
+                ok = false;
+            }
+            if (m == 1 && (Cmax != schrage || order != single)) {
+                std::cerr << "NIEZGODNOŚĆ z schragePlaning dla n = " << n << std::endl;
+                ok = false;
+            }
+
+            const BenchmarkStats stats = runBenchmark([&] {
+                return schrageMachinesPlaning(instance, arena, m, order.data(), machineOf.data());
+            });
+            std::cout << std::setw(10) << n << std::setw(6) << m << std::setw(14) << Cmax << std::fixed
+                      << std::setprecision(3) << std::setw(14) << stats.median * 1e3 << std::setw(12)
+                      << std::setprecision(2) << stats.median * 1e9 / n
+                      << instrumentation::tableColumn(stats.sample) << std::endl;
+        }
+    }
+
+    return ok ? 0 : 1;
+}
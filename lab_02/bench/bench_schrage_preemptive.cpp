@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "alg_01_schrage.h"
+#include "bench_common.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Wzorcowa symulacja Schrage z wywłaszczeniem krok po kroku (jednostka czasu na obrót pętli).
+ *
+ * Bardzo wolna (O(suma p * n)), ale oczywiście poprawna - służy do sprawdzania wersji zdarzeniowej.
+ */
+static int referencePreemptive(const std::vector<task> &tasks) {
+    const size_t n = tasks.size();
+    std::vector<int> remaining(n);
+    for (size_t i = 0; i < n; i++) {
+        remaining[i] = tasks[i].p;
+    }
+
+    size_t done = 0;
+    int t = 0, Cmax = 0;
+    while (done < n) {
+        int best = -1;
+        for (size_t i = 0; i < n; i++) {
+            if (remaining[i] > 0 && tasks[i].r <= t && (best == -1 || tasks[i].q > tasks[best].q)) {
+                best = static_cast<int>(i);
+            }
+        }
+        t++;
+        if (best == -1) {
+            continue;
+        }
+        if (--remaining[best] == 0) {
+            done++;
+            Cmax = std::max(Cmax, t + tasks[best].q);
+        }
+    }
+    return Cmax;
+}
+
+/**
+ * @brief Test różnicowy: porównanie z symulacją wzorcową na losowych małych instancjach
+ * (z częstymi remisami r i q), a następnie benchmark skalowania do 10^7 zadań. W kompilacji
+ * z instrumentacją wiersz zawiera też liczniki całej mierzonej pętli powtórzeń.
+ *
+ * Użycie: bench_schrage_preemptive [maksymalne_n]
+ */
+int main(int argc, char **argv) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 10000000L;
+
+    ScratchArena arena;
+    std::mt19937 gen(12345);
+    const int checks = 20000;
+    for (int k = 0; k < checks; k++) {
+        int n = 1 + static_cast<int>(gen() % 12);
+        std::vector<task> tasks(n);
+        for (int i = 0; i < n; i++) {
+            tasks[i] = {i + 1, static_cast<int>(gen() % 25), 1 + static_cast<int>(gen() % 8),
+                        static_cast<int>(gen() % 15)};
+        }
+
+        int expected = referencePreemptive(tasks);
+        int actual = schragePreemptivePlaning(Instance(tasks), arena);
+        if (expected != actual) {
+            std::cerr << "Niezgodność w teście " << k << ": " << actual << " zamiast " << expected << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "Test różnicowy: " << checks << " instancji zgodnych z symulacją wzorcową" << std::endl << std::endl;
+
+    std::cout << std::setw(10) << "n" << std::setw(14) << "czas [ms]"
+              << std::setw(14) << "ns/zadanie" << std::setw(16) << "Cmax" << instrumentation::tableHeader() << std::endl;
+
+    for (long n = 1000; n <= maxN; n *= 10) {
+        const Instance instance(randomTasks(static_cast<int>(n), 2025));
+
+        int repeats = static_cast<int>(std::max(1L, 1000000L / n));
+        int Cmax = 0;
+        instrumentation::Sample sample;
+        double seconds = measureSeconds([&] {
+            for (int k = 0; k < repeats; k++) {
+                Cmax = schragePreemptivePlaning(instance, arena);
+            }
+        }, &sample) / repeats;
+
+        std::cout << std::setw(10) << n
+                  << std::setw(14) << std::fixed << std::setprecision(3) << seconds * 1e3
+                  << std::setw(14) << std::setprecision(1) << seconds * 1e9 / n
+                  << std::setw(16) << Cmax << instrumentation::tableColumn(sample) << std::endl;
+    }
+
+    return 0;
+}
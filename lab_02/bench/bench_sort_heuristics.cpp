@@ -0,0 +1,73 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "alg_00_heuristic.h"
+#include "bench_common.h"
+#include "benchmark.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Mierzy jeden wariant.
+ */
+template<typename Func>
+static BenchmarkStats measure(Func func, const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    return runBenchmark([&] { return func(instance, arena, order); });
+}
+
+/**
+ * @brief Benchmark heurystyk RjSort/QjSort: std::sort kluczy 64-bitowych a sortowanie pozycyjne kluczy 32-bitowych.
+ *
+ * Dla każdego rozmiaru sprawdza, czy oba warianty dają tę samą permutację, i wypisuje mediany czasów
+ * oraz przyspieszenie. Zakres r/q rośnie z n (randomTasks), więc sortowanie pozycyjne potrzebuje
+ * 2-3 przebiegów. W kompilacji z instrumentacją pod wierszem wypisywane są liczniki pierwszego przebiegu
+ * runBenchmark każdego wariantu.
+ *
+ * Użycie: bench_sort_heuristics [maksymalne_n=10000000]
+ */
+int main(int argc, char **argv) {
+    long maxN = argc > 1 ? std::atol(argv[1]) : 10000000L;
+
+    std::cout << std::setw(10) << "n" << std::setw(16) << "RjSort [ms]" << std::setw(16) << "radix [ms]"
+              << std::setw(12) << "speedup" << std::setw(16) << "QjSort [ms]" << std::setw(16) << "radix [ms]"
+              << std::setw(12) << "speedup" << std::endl;
+
+    ScratchArena arena;
+    std::vector<int> order, radixOrder;
+    bool ok = true;
+    for (long n = 1000; n <= maxN; n *= 10) {
+        const Instance instance(randomTasks(static_cast<int>(n), 2025));
+
+        // Porównanie wyników przed pomiarem
+        const int rjCmax = rjSortPlaning(instance, arena, order);
+        const bool rjSame = rjSortRadixPlaning(instance, arena, radixOrder) == rjCmax && order == radixOrder;
+        const int qjCmax = qjSortPlaning(instance, arena, order);
+        const bool qjSame = qjSortRadixPlaning(instance, arena, radixOrder) == qjCmax && order == radixOrder;
+        if (!rjSame || !qjSame) {
+            std::cerr << "NIEZGODNOŚĆ permutacji dla n = " << n << (rjSame ? " (QjSort)" : " (RjSort)") << std::endl;
+            ok = false;
+        }
+
+        const BenchmarkStats rjStats = measure(rjSortPlaning, instance, arena, order);
+        const BenchmarkStats rjRadixStats = measure(rjSortRadixPlaning, instance, arena, order);
+        const BenchmarkStats qjStats = measure(qjSortPlaning, instance, arena, order);
+        const BenchmarkStats qjRadixStats = measure(qjSortRadixPlaning, instance, arena, order);
+        const double rj = rjStats.median * 1e3, rjRadix = rjRadixStats.median * 1e3;
+        const double qj = qjStats.median * 1e3, qjRadix = qjRadixStats.median * 1e3;
+
+        std::cout << std::setw(10) << n << std::fixed << std::setprecision(3)
+                  << std::setw(16) << rj << std::setw(16) << rjRadix
+                  << std::setw(11) << std::setprecision(2) << rj / rjRadix << "x"
+                  << std::setw(16) << std::setprecision(3) << qj << std::setw(16) << qjRadix
+                  << std::setw(11) << std::setprecision(2) << qj / qjRadix << "x" << std::endl;
+        if (instrumentation::ENABLED) {
+            std::cout << std::setw(10) << "" << "  RjSort:       " << instrumentation::describe(rjStats.sample) << std::endl
+                      << std::setw(10) << "" << "  RjSort radix: " << instrumentation::describe(rjRadixStats.sample)
+                      << std::endl
+                      << std::setw(10) << "" << "  QjSort:       " << instrumentation::describe(qjStats.sample) << std::endl
+                      << std::setw(10) << "" << "  QjSort radix: " << instrumentation::describe(qjRadixStats.sample)
+                      << std::endl;
+        }
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "alg_01_schrage.h"
+#include "alg_04_carlier.h"
+#include "alg_07_tabu.h"
+#include "bench_common.h"
+#include "instance_io.h"
+#include "instrumentation.h"
+
+/**
+ * @brief Uruchamia tabu z rosnącym limitem iteracji i wypisuje Cmax w funkcji czasu.
+ *
+ * Przeszukiwanie jest deterministyczne, więc kolejne limity to punkty tej samej trajektorii.
+ *
+ * @param name Nazwa instancji.
+ * @param instance Instancja problemu.
+ * @param reference Wartość odniesienia (optimum z algorytmu Carliera lub dolne ograniczenie).
+ * @param maxIterations Największy badany limit iteracji.
+ */
+static void runInstance(const std::string &name, const Instance &instance, int reference, int maxIterations) {
+    ScratchArena arena;
+    std::vector<int> order;
+    const int schrage = schragePlaning(instance, arena, order);
+
+    for (int limit = 1; limit <= maxIterations; limit *= 10) {
+        TabuOptions options;
+        options.maxIterations = limit;
+        options.maxStagnation = limit;
+
+        int Cmax = 0;
+        instrumentation::Sample sample;
+        double seconds = measureSeconds([&] { Cmax = tabuSearchPlaning(instance, arena, order, options); }, &sample);
+
+        std::cout << std::setw(12) << name << std::setw(10) << instance.size() << std::setw(10) << limit
+                  << std::setw(14) << std::fixed << std::setprecision(3) << seconds * 1e3
+                  << std::setw(12) << schrage << std::setw(12) << Cmax << std::setw(12) << reference
+                  << std::setw(10) << std::setprecision(3) << 100.0 * (Cmax - reference) / reference
+                  << instrumentation::tableColumn(sample) << std::endl;
+        if (Cmax == reference) {
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Benchmark przeszukiwania z tabu: Cmax w funkcji czasu na SCHRAGE1-9 i dużych instancjach losowych.
+ *
+ * Dla SCHRAGE* odniesieniem jest optimum (algorytm Carliera), dla instancji losowych dolne
+ * ograniczenie (Schrage z wywłaszczaniem). W kompilacji z instrumentacją wiersz zawiera też liczniki
+ * mierzonego przebiegu.
+ *
+ * Użycie: bench_tabu [maksymalne_n=100000] [maksymalny_limit_iteracji=10000]
+ */
+int main(int argc, char **argv) {
+    int maxN = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int maxIterations = argc > 2 ? std::atoi(argv[2]) : 10000;
+
+    std::cout << std::setw(12) << "instancja" << std::setw(10) << "n" << std::setw(10) << "iteracje"
+              << std::setw(14) << "czas [ms]" << std::setw(12) << "Schrage" << std::setw(12) << "tabu"
+              << std::setw(12) << "odniesienie" << std::setw(12) << "błąd [%]"
+              << instrumentation::tableHeader() << std::endl;
+
+    ScratchArena arena;
+    std::vector<int> order;
+    for (int i = 1; i <= 9; i++) {
+        std::string name = "SCHRAGE" + std::to_string(i);
+        LoadResult loaded = loadInstance("data/" + name + ".dat");
+        if (!loaded) {
+            std::cerr << loaded.error << std::endl;
+            continue;
+        }
+        runInstance(name, loaded.instance, carlierPlaning(loaded.instance, arena, order), maxIterations);
+    }
+
+    for (int n = 1000; n <= maxN; n *= 10) {
+        const Instance instance(tightTasks(n, 0.7, 2025));
+        runInstance("losowa", instance, schragePreemptivePlaning(instance, arena), maxIterations);
+    }
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "alg_03_wspt.h"
+#include "bench_common.h"
+#include "instance_io.h"
+#include "wspt_tuner.h"
+
+/**
+ * @brief Rodzina instancji, dla której dobieramy wspólne wagi.
+ */
+struct Family {
+    std::string name;
+    std::vector<Instance> instances;
+
+    std::vector<const Instance *> pointers() const {
+        std::vector<const Instance *> result;
+        for (const Instance &instance: instances) {
+            result.push_back(&instance);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Wypisuje wiersz tabeli dla jednego sposobu strojenia.
+ */
+static void report(const std::string &family, const std::string &search, const WsptTuning &tuning, double baseline) {
+    std::cout << std::setw(14) << family << std::setw(16) << search << std::fixed << std::setprecision(3)
+              << std::setw(9) << tuning.weights.q << std::setw(9) << tuning.weights.r
+              << std::setw(10) << std::setprecision(2) << (baseline - 1) * 100
+              << std::setw(10) << (tuning.score - 1) * 100 << std::setw(9) << tuning.evaluations
+              << std::setw(12) << std::setprecision(0) << tuning.evaluationsPerSecond() << std::endl;
+}
+
+/**
+ * @brief Benchmark strojenia wag WSPT.
+ *
+ * Dla każdej rodziny instancji wypisuje najlepsze wagi znalezione siatką (tylko q oraz q i r)
+ * i złotym podziałem, średnią odległość od dolnego ograniczenia przed i po strojeniu
+ * oraz przepustowość w ocenach na sekundę. Na końcu przepustowość siatki na jednej dużej
+ * instancji w zależności od liczby wątków.
+ *
+ * Użycie: bench_wspt_tuner [n=1000] [instancji_w_rodzinie=8] [duże_n=100000]
+ */
+int main(int argc, char **argv) {
+    const int n = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int count = argc > 2 ? std::atoi(argv[2]) : 8;
+    const int largeN = argc > 3 ? std::atoi(argv[3]) : 100000;
+
+    std::vector<Family> families(3);
+    families[0].name = "losowe";
+    families[1].name = "ciasne 0.7";
+    families[2].name = "ciasne 0.3";
+    for (int k = 0; k < count; k++) {
+        families[0].instances.emplace_back(randomTasks(n, 100 + k));
+        families[1].instances.emplace_back(tightTasks(n, 0.7, 200 + k));
+        families[2].instances.emplace_back(tightTasks(n, 0.3, 300 + k));
+    }
+    Family files{"SCHRAGE*.dat", {}};
+    for (int i = 1; i <= 9; i++) {
+        LoadResult loaded = loadInstance("data/SCHRAGE" + std::to_string(i) + ".dat");
+        if (loaded) {
+            files.instances.push_back(std::move(loaded.instance));
+        }
+    }
+    if (!files.instances.empty()) {
+        families.push_back(std::move(files));
+    }
+
+    std::cout << std::setw(14) << "rodzina" << std::setw(16) << "strojenie" << std::setw(9) << "q"
+              << std::setw(9) << "r" << std::setw(10) << "q=0.5 [%]" << std::setw(10) << "LB+ [%]"
+              << std::setw(9) << "ocen" << std::setw(12) << "ocen/s" << std::endl;
+
+    WsptTunerOptions fixed;
+    fixed.qMin = fixed.qMax = 0.5;
+    fixed.qSteps = 1;
+
+    WsptTunerOptions qGrid;
+    WsptTunerOptions qrGrid;
+    qrGrid.tuneR = true;
+    WsptTunerOptions golden;
+    golden.search = WsptSearch::GoldenSection;
+    golden.tuneR = true;
+
+    for (const Family &family: families) {
+        const std::vector<const Instance *> instances = family.pointers();
+        const double baseline = tuneWsptWeights(instances, fixed).score;
+        report(family.name, "siatka q", tuneWsptWeights(instances, qGrid), baseline);
+        report(family.name, "siatka q, r", tuneWsptWeights(instances, qrGrid), baseline);
+        report(family.name, "złoty podział", tuneWsptWeights(instances, golden), baseline);
+    }
+
+    // Zgodność: wynik strojenia pojedynczej instancji to Cmax weightedSPTPlaning dla dobranych wag
+    const Instance large(randomTasks(largeN, 2025));
+    std::vector<int> order;
+    const WsptTuning check = tuneWsptWeights(large, order, qrGrid);
+    ScratchArena arena;
+    const double LB = std::max(1, schragePreemptivePlaning(large, arena));
+    if (check.Cmax / LB != check.score) {
+        std::cerr << "NIEZGODNOŚĆ: Cmax " << check.Cmax << " a ocena strojenia " << check.score * LB << std::endl;
+        return 1;
+    }
+
+    std::cout << std::endl << "n = " << largeN << ", siatka q, r (" << check.evaluations << " ocen)" << std::endl;
+    std::cout << std::setw(8) << "wątki" << std::setw(12) << "czas [s]" << std::setw(12) << "ocen/s"
+              << std::setw(14) << "zadań/s [M]" << std::endl;
+    const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        WsptTunerOptions options = qrGrid;
+        options.threadCount = threads;
+        const WsptTuning tuning = tuneWsptWeights(std::vector<const Instance *>{&large}, options);
+        std::cout << std::setw(8) << threads << std::fixed << std::setprecision(3) << std::setw(12) << tuning.seconds
+                  << std::setw(12) << std::setprecision(0) << tuning.evaluationsPerSecond()
+                  << std::setw(14) << std::setprecision(1) << tuning.evaluationsPerSecond() * largeN / 1e6 << std::endl;
+    }
+    return 0;
+}
@@ -1,11 +1,16 @@
 #ifndef ALG_00_HEURISTIC_H
 #define ALG_00_HEURISTIC_H
-#include "task_struct.h"
+#include "instance.h"
+#include "scratch_arena.h"
 #include <vector>
 #include <algorithm>
 
-int rjSortPlaning(std::vector<task> tasks);
+int rjSortPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
 
-int qjSortPlaning(std::vector<task> tasks);
+int qjSortPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+int rjSortRadixPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+int qjSortRadixPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
 
 #endif //ALG_00_HEURISTIC_H
@@ -6,12 +6,90 @@
 #include <algorithm>
 #include <fstream>
 #include <climits>
+#include <optional>
 #include <queue>
 
+#include "instance.h"
+#include "scratch_arena.h"
 #include "task_struct.h"
 
-int schragePlaning(std::vector<task> tasks);
+int schragePlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
 
-int schragePreemptivePlaning(std::vector<task> tasks);
+int schragePlaning(const Instance &instance, ScratchArena &arena, int *order);
+
+int schragePreemptivePlaning(const Instance &instance, ScratchArena &arena);
+
+int schrageMachinesPlaning(const Instance &instance, ScratchArena &arena, int machines, int *order, int *machineOf);
+
+int schrageMachinesPlaning(const Instance &instance, ScratchArena &arena, int machines, std::vector<int> &order,
+                           std::vector<int> &machineOf);
+
+/**
+ * @class SchrageDispatcher
+ * @brief Reguła Schrage w wersji przyrostowej (online) dla zadań napływających w trakcie pracy.
+ *
+ * Dyspozytor ma jeden zegar: chwilę, w której maszyna jest wolna i czeka na decyzję. Zadania
+ * z r <= zegar są gotowe, pozostałe czekają w kopcu po r. next() uruchamia gotowe zadanie o
+ * największym q (przy remisie to o mniejszym r, potem wcześniej zgłoszone) i przesuwa zegar
+ * o jego czas wykonania. Każda operacja działa w czasie O(log n).
+ *
+ * Jeśli wszystkie zadania zgłosi się od razu w kolejności indeksów, a przy pustym zbiorze gotowych
+ * przesuwa zegar do nextRelease(), kolejność decyzji jest identyczna z schragePlaning.
+ */
+class SchrageDispatcher {
+private:
+    /**
+     * @brief Zadanie w kopcu wraz z numerem zgłoszenia (rozstrzyga remisy)
+     */
+    struct Entry {
+        task job;
+        unsigned sequence;
+    };
+
+    std::vector<Entry> pending;  ///< Kopiec zadań jeszcze niedostępnych (najmniejsze r na szczycie)
+    std::vector<Entry> ready;    ///< Kopiec zadań gotowych (największe q na szczycie)
+    int clock = 0;               ///< Chwila, w której maszyna jest wolna
+    int Cmax = 0;                ///< Największe C + q wśród uruchomionych zadań
+    unsigned submitted = 0;      ///< Liczba zgłoszonych zadań
+
+    void release();
+
+public:
+    /**
+     * @brief Rezerwuje miejsce na count jednocześnie oczekujących zadań (bez alokacji w trakcie pracy)
+     */
+    void reserve(size_t count);
+
+    void submit(const task &job);
+
+    void advance(int time);
+
+    std::optional<task> next();
+
+    /**
+     * @brief Chwila, w której maszyna będzie wolna
+     */
+    int time() const { return clock; }
+
+    /**
+     * @brief Cmax dotychczas uruchomionych zadań
+     */
+    int cmax() const { return Cmax; }
+
+    /**
+     * @brief Najmniejszy czas dostępności wśród niedostępnych zadań (INT_MAX, jeśli brak)
+     */
+    int nextRelease() const { return pending.empty() ? INT_MAX : pending.front().job.r; }
+
+    /**
+     * @brief Liczba zadań gotowych do uruchomienia
+     */
+    size_t readyCount() const { return ready.size(); }
+
+    /**
+     * @brief Liczba zadań, które jeszcze nie zostały uruchomione
+     */
+    size_t size() const { return pending.size() + ready.size(); }
+};
 
 #endif //ALG_01_HEURISTIC_H
@@ -6,8 +6,17 @@
 #include <algorithm>
 #include <fstream>
 #include <climits>
-#include "task_struct.h"
+#include "anytime.h"
+#include "instance.h"
+#include "scratch_arena.h"
 
-int bruteForce(std::vector<task> tasks);
+int bruteForce(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+int bruteForce(const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control);
+
+int bruteForceParallel(const Instance &instance, std::vector<int> &order, int threadCount);
+
+int bruteForceParallel(const Instance &instance, std::vector<int> &order, int threadCount,
+                       const AnytimeControl &control);
 
 #endif //ALG_02_BRUTE_FORCE_H
@@ -4,8 +4,27 @@
 #include <vector>
 #include <algorithm>
 #include <numeric>
-#include "task_struct.h"
+#include "instance.h"
+#include "scratch_arena.h"
 
-int weightedSPTPlaning(std::vector<task> tasks);
+/**
+ * @brief Współczynniki priorytetu WSPT: priorytet = p - q * q_j + r * r_j (niższy = wcześniej).
+ */
+struct WsptWeights {
+    double q = 0.5;  ///< Waga czasu dostarczenia
+    double r = 0.0;  ///< Waga momentu dostępności
+};
 
-#endif
\ No newline at end of file
+/**
+ * @brief Priorytet zadania; jedno wyrażenie dla WSPT i dla strojenia wag, żeby obie ścieżki dawały tę samą kolejność
+ */
+inline double wsptPriority(int p, int q, int r, const WsptWeights &weights) {
+    return p - weights.q * q + weights.r * r;
+}
+
+int weightedSPTPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+int weightedSPTPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                       const WsptWeights &weights);
+
+#endif
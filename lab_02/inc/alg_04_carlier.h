@@ -0,0 +1,14 @@
+#ifndef ALG_04_CARLIER_H
+#define ALG_04_CARLIER_H
+
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+#include "scratch_arena.h"
+
+int carlierPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+int carlierPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                   const AnytimeControl &control);
+
+#endif //ALG_04_CARLIER_H
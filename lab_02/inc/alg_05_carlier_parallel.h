@@ -0,0 +1,13 @@
+#ifndef ALG_05_CARLIER_PARALLEL_H
+#define ALG_05_CARLIER_PARALLEL_H
+
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+
+int carlierParallelPlaning(const Instance &instance, std::vector<int> &order, int threadCount);
+
+int carlierParallelPlaning(const Instance &instance, std::vector<int> &order, int threadCount,
+                           const AnytimeControl &control);
+
+#endif //ALG_05_CARLIER_PARALLEL_H
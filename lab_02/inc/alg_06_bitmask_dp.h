@@ -0,0 +1,13 @@
+#ifndef ALG_06_BITMASK_DP_H
+#define ALG_06_BITMASK_DP_H
+
+#include <vector>
+#include "instance.h"
+#include "scratch_arena.h"
+
+/// Największa liczba zadań obsługiwana przez programowanie dynamiczne po podzbiorach (2^25 stanów = 128 MB)
+constexpr int BITMASK_DP_MAX_TASKS = 25;
+
+int bitmaskDPPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order);
+
+#endif //ALG_06_BITMASK_DP_H
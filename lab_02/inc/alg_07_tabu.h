@@ -0,0 +1,24 @@
+#ifndef ALG_07_TABU_H
+#define ALG_07_TABU_H
+
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+#include "scratch_arena.h"
+
+/**
+ * @brief Parametry przeszukiwania z tabu.
+ */
+struct TabuOptions {
+    int maxIterations = 2000;        ///< Maksymalna liczba iteracji
+    int maxStagnation = 500;         ///< Liczba iteracji bez poprawy, po której przerywamy
+    int tenure = 8;                  ///< Liczba iteracji, przez które przesunięte zadanie jest zakazane
+};
+
+int tabuSearchPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                      const TabuOptions &options = TabuOptions());
+
+int tabuSearchPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                      const TabuOptions &options, const AnytimeControl &control);
+
+#endif //ALG_07_TABU_H
@@ -0,0 +1,46 @@
+#ifndef ALG_08_PORTFOLIO_H
+#define ALG_08_PORTFOLIO_H
+
+#include <vector>
+#include "alg_07_tabu.h"
+#include "instance.h"
+
+/**
+ * @brief Parametry portfolio algorytmów.
+ */
+struct PortfolioOptions {
+    double timeBudgetSeconds = 1.0;  ///< Limit czasu całego portfolio
+    int threadCount = 0;             ///< Liczba wątków (0 oznacza liczbę rdzeni)
+    TabuOptions tabu;                ///< Parametry przeszukiwania z tabu
+};
+
+/**
+ * @brief Przebieg jednego algorytmu portfolio.
+ */
+struct PortfolioRun {
+    const char *algorithm = nullptr; ///< Nazwa algorytmu (jak w algorithm_registry)
+    int Cmax = -1;                   ///< Wynik; -1, jeśli algorytm nie zdążył się uruchomić
+    double seconds = 0;              ///< Czas od startu portfolio do zakończenia algorytmu
+};
+
+/**
+ * @brief Wynik portfolio: najlepsze rozwiązanie wraz z pochodzeniem i czasami.
+ */
+struct PortfolioResult {
+    int Cmax = 0;                    ///< Najlepszy znaleziony Cmax
+    int lowerBound = 0;              ///< Dolne ograniczenie (Schrage z wywłaszczaniem)
+    const char *algorithm = nullptr; ///< Algorytm, który znalazł najlepsze rozwiązanie
+    double secondsToBest = 0;        ///< Czas od startu do znalezienia najlepszego rozwiązania
+    double totalSeconds = 0;         ///< Czas działania całego portfolio
+    bool optimal = false;            ///< Czy Cmax osiągnął dolne ograniczenie
+    bool interrupted = false;        ///< Czy przerwano (limit czasu, termin lub flaga przerwania)
+    std::vector<PortfolioRun> runs;  ///< Przebiegi poszczególnych algorytmów
+};
+
+PortfolioResult portfolioPlaning(const Instance &instance, std::vector<int> &order,
+                                 const PortfolioOptions &options = PortfolioOptions());
+
+PortfolioResult portfolioPlaning(const Instance &instance, std::vector<int> &order, const PortfolioOptions &options,
+                                 const AnytimeControl &control);
+
+#endif //ALG_08_PORTFOLIO_H
@@ -0,0 +1,29 @@
+#ifndef ALG_09_ANNEALING_H
+#define ALG_09_ANNEALING_H
+
+#include <cstdint>
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+#include "scratch_arena.h"
+
+/**
+ * @brief Parametry symulowanego wyżarzania.
+ */
+struct AnnealingOptions {
+    long maxMoves = 200000;          ///< Liczba proponowanych ruchów
+    int maxShift = 32;               ///< Największa odległość przeniesienia zadania
+    double swapShare = 0.5;          ///< Udział zamian sąsiednich zadań wśród ruchów (reszta to przeniesienia)
+    double startTemperature = -1;    ///< Temperatura początkowa (< 0 - dobierana z próbki ruchów)
+    double endTemperature = -1;      ///< Temperatura końcowa (< 0 - 1/1000 temperatury początkowej)
+    uint64_t seed = 2025;            ///< Ziarno generatora (ten sam wynik dla tego samego ziarna)
+    bool stopAtLowerBound = true;    ///< Czy kończyć po osiągnięciu dolnego ograniczenia (false - pełne maxMoves ruchów)
+};
+
+int simulatedAnnealingPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                              const AnnealingOptions &options = AnnealingOptions());
+
+int simulatedAnnealingPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                              const AnnealingOptions &options, const AnytimeControl &control);
+
+#endif //ALG_09_ANNEALING_H
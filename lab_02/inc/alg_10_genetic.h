@@ -0,0 +1,39 @@
+#ifndef ALG_10_GENETIC_H
+#define ALG_10_GENETIC_H
+
+#include <cstdint>
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+
+/**
+ * @brief Operator krzyżowania permutacji.
+ */
+enum class Crossover {
+    OX,  ///< Order crossover: fragment pierwszego rodzica, reszta w kolejności z drugiego
+    PMX  ///< Partially mapped crossover: fragment pierwszego rodzica, konflikty rozwiązywane odwzorowaniem
+};
+
+/**
+ * @brief Parametry algorytmu genetycznego z modelem wysp.
+ */
+struct GeneticOptions {
+    int islands = 0;               ///< Liczba wysp, każda w osobnym wątku (0 - liczba rdzeni)
+    int populationSize = 64;       ///< Liczba osobników na wyspie
+    int generations = 300;         ///< Liczba pokoleń na każdej wyspie
+    Crossover crossover = Crossover::OX;
+    double mutationRate = 0.3;     ///< Prawdopodobieństwo mutacji (zamiany dwóch zadań) potomka
+    int elite = 2;                 ///< Najlepsze osobniki przechodzące bez zmian do następnego pokolenia
+    int migrationInterval = 25;    ///< Co ile pokoleń wyspa wysyła i odbiera migrantów
+    int migrants = 2;              ///< Liczba migrantów
+    uint64_t seed = 2025;          ///< Ziarno (wynik jest powtarzalny dla jednej wyspy)
+    bool stopAtLowerBound = true;  ///< Czy kończyć po osiągnięciu dolnego ograniczenia (false - stała liczba pokoleń)
+};
+
+int geneticPlaning(const Instance &instance, std::vector<int> &order,
+                   const GeneticOptions &options = GeneticOptions());
+
+int geneticPlaning(const Instance &instance, std::vector<int> &order, const GeneticOptions &options,
+                   const AnytimeControl &control);
+
+#endif //ALG_10_GENETIC_H
@@ -0,0 +1,30 @@
+#ifndef ALGORITHM_REGISTRY_H
+#define ALGORITHM_REGISTRY_H
+
+#include <climits>
+#include <string>
+#include <vector>
+#include "anytime.h"
+#include "instance.h"
+#include "scratch_arena.h"
+
+/**
+ * @brief Opis algorytmu dostępnego dla programów wsadowych i benchmarków.
+ */
+struct AlgorithmInfo {
+    const char *name;   ///< Nazwa używana w wynikach i w opcjach wiersza poleceń
+    int (*run)(const Instance &, ScratchArena &, std::vector<int> &); ///< Uruchomienie algorytmu
+    int maxTasks;       ///< Największa rozsądna liczba zadań (INT_MAX - bez ograniczeń)
+    bool producesOrder; ///< Czy algorytm zwraca permutację (Schrage z wywłaszczaniem - nie)
+    bool exact;         ///< Czy wynik jest optymalny
+    /// Uruchomienie z przerwaniem i zadaną liczbą wątków (0 - liczba rdzeni); nullptr - algorytm
+    /// nie da się przerwać i działa jednowątkowo, więc używane jest run
+    int (*runControlled)(const Instance &, ScratchArena &, std::vector<int> &, const AnytimeControl &,
+                         int threadCount) = nullptr;
+};
+
+const std::vector<AlgorithmInfo> &algorithms();
+
+const AlgorithmInfo *findAlgorithm(const std::string &name);
+
+#endif //ALGORITHM_REGISTRY_H
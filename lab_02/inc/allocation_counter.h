@@ -0,0 +1,15 @@
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+/**
+ * @brief Zwraca liczbę alokacji na stercie (operator new) wykonanych dotąd przez bieżący wątek.
+ *
+ * Licznik działa dzięki zastąpieniu globalnego operatora new w allocation_counter.cpp; plik ten
+ * trafia do programu, gdy program wywołuje tę funkcję. Różnica dwóch odczytów wokół wywołania
+ * algorytmu daje liczbę jego alokacji (bez alokacji w wątkach, które algorytm sam uruchamia).
+ *
+ * @return Liczba wywołań operatora new w bieżącym wątku.
+ */
+long threadAllocations();
+
+#endif //ALLOCATION_COUNTER_H
@@ -0,0 +1,31 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Format wyników trybu wsadowego
+ */
+enum class BatchFormat {
+    CSV, ///< Wiersz nagłówka i jeden wiersz na parę (instancja, algorytm)
+    JSON ///< Tablica obiektów, jeden obiekt na parę (instancja, algorytm)
+};
+
+/**
+ * @brief Parametry trybu wsadowego.
+ */
+struct BatchOptions {
+    std::vector<std::string> inputs;     ///< Katalogi, wzorce glob albo pojedyncze pliki .dat/.bin
+    std::vector<std::string> algorithms; ///< Nazwy algorytmów (puste - wszystkie z algorithms())
+    BatchFormat format = BatchFormat::CSV;
+    int threadCount = 0;                 ///< Liczba wątków puli (0 - liczba rdzeni)
+    double timeLimitSeconds = 0;         ///< Limit czasu jednego algorytmu na jednej instancji (0 - bez limitu)
+};
+
+std::vector<std::string> expandInputs(const std::vector<std::string> &inputs, std::string &error);
+
+int runBatch(const BatchOptions &options, std::ostream &out, std::ostream &err);
+
+#endif //BATCH_RUNNER_H
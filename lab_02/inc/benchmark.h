@@ -0,0 +1,97 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "instrumentation.h"
+
+/**
+ * @brief Parametry pomiaru w runBenchmark.
+ */
+struct BenchmarkOptions {
+    double warmupSeconds = 0.01;  ///< Łączny czas przebiegów rozgrzewkowych
+    double budgetSeconds = 0.2;   ///< Łączny czas mierzonych przebiegów (po osiągnięciu minRuns)
+    int minRuns = 5;              ///< Najmniejsza liczba mierzonych przebiegów
+    int maxRuns = 100000;         ///< Największa liczba mierzonych przebiegów
+};
+
+/**
+ * @brief Statystyki czasu pojedynczego przebiegu (w sekundach).
+ */
+struct BenchmarkStats {
+    int runs = 0;       ///< Liczba mierzonych przebiegów
+    double min = 0;     ///< Najkrótszy przebieg
+    double median = 0;  ///< Mediana
+    double p99 = 0;     ///< 99. percentyl
+    double mean = 0;    ///< Średnia
+    instrumentation::Sample sample;  ///< Liczniki pierwszego przebiegu (puste bez INSTRUMENTATION=ON)
+};
+
+/**
+ * @brief Bariera dla optymalizatora: wartość uznawana jest za użytą, więc obliczenie nie zostanie usunięte.
+ */
+template<typename T>
+inline void doNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+BenchmarkStats summarizeSamples(std::vector<double> &samples);
+
+bool pinCurrentThread(int cpu);
+
+/**
+ * @brief Mierzy czas funkcji: rozgrzewka, powtarzane przebiegi, statystyki min/mediana/p99.
+ *
+ * Pierwsze wywołanie jest rozgrzewką. Jeśli samo trwało dłużej niż budżet pomiaru, jego czas jest
+ * jedyną próbką (przy takich czasach rozgrzewka nie ma znaczenia, a powtórzenia kosztowałyby za dużo).
+ * Wynik funkcji przechodzi przez doNotOptimize. W kompilacji z instrumentacją liczniki pierwszego
+ * wywołania trafiają do stats.sample (liczniki perf są włączane i odczytywane poza mierzonym czasem).
+ *
+ * @param func Mierzona funkcja (bez argumentów, zwraca wartość).
+ * @param options Parametry pomiaru.
+ * @return Statystyki czasu przebiegu.
+ */
+template<typename Func>
+BenchmarkStats runBenchmark(Func &&func, const BenchmarkOptions &options = BenchmarkOptions()) {
+    using Clock = std::chrono::steady_clock;
+    auto seconds = [](Clock::time_point start, Clock::time_point end) {
+        return std::chrono::duration<double>(end - start).count();
+    };
+
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(std::min(options.maxRuns, 4096)));
+
+    instrumentation::Probe probe;
+    auto start = Clock::now();
+    doNotOptimize(func());
+    double first = seconds(start, Clock::now());
+    const instrumentation::Sample sample = probe.finish();
+    if (first >= options.budgetSeconds) {
+        samples.push_back(first);
+        BenchmarkStats stats = summarizeSamples(samples);
+        stats.sample = sample;
+        return stats;
+    }
+
+    for (double warmup = first; warmup < options.warmupSeconds;) {
+        start = Clock::now();
+        doNotOptimize(func());
+        warmup += seconds(start, Clock::now());
+    }
+
+    double total = 0;
+    while (static_cast<int>(samples.size()) < options.maxRuns &&
+           (static_cast<int>(samples.size()) < options.minRuns || total < options.budgetSeconds)) {
+        start = Clock::now();
+        doNotOptimize(func());
+        const double elapsed = seconds(start, Clock::now());
+        samples.push_back(elapsed);
+        total += elapsed;
+    }
+    BenchmarkStats stats = summarizeSamples(samples);
+    stats.sample = sample;
+    return stats;
+}
+
+#endif //BENCHMARK_H
@@ -0,0 +1,26 @@
+#ifndef CMAX_EVAL_H
+#define CMAX_EVAL_H
+
+#include <vector>
+#include "instance.h"
+
+/**
+ * @brief Wariant obliczeń używany przez evaluateCmaxBatch.
+ */
+enum class BatchKernel {
+    Auto,   ///< Najszybszy wariant dostępny na bieżącym procesorze
+    Scalar, ///< Zwykła pętla, bez instrukcji wektorowych
+    AVX2,   ///< 8 kandydatów naraz
+    AVX512  ///< 16 kandydatów naraz
+};
+
+int evaluateCmax(const Instance &instance, const int *order);
+
+bool batchKernelSupported(BatchKernel kernel);
+
+const char *batchKernelName(BatchKernel kernel);
+
+BatchKernel evaluateCmaxBatch(const Instance &instance, const int *permutations, int count,
+                              int *results, BatchKernel kernel = BatchKernel::Auto);
+
+#endif //CMAX_EVAL_H
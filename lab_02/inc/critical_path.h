@@ -0,0 +1,27 @@
+#ifndef CRITICAL_PATH_H
+#define CRITICAL_PATH_H
+
+#include "instance.h"
+
+/**
+ * @brief Ścieżka krytyczna permutacji dla problemu 1|r_j,q_j|Cmax.
+ *
+ * Wszystkie indeksy są pozycjami w permutacji. Blok krytyczny a..b to ciąg zadań wykonywanych bez
+ * przestoju, zakończony ostatnim zadaniem z C + q = Cmax; blok K = (c, b] leży za zadaniem
+ * interferencyjnym c.
+ */
+struct CriticalPath {
+    int Cmax = 0;   ///< Cmax permutacji
+    int a = -1;     ///< Początek bloku krytycznego (r zadania na tej pozycji = jego moment rozpoczęcia)
+    int b = -1;     ///< Ostatnia pozycja z C + q = Cmax
+    int c = -1;     ///< Ostatnia pozycja w a..b-1 z q mniejszym niż q na pozycji b (-1 - brak)
+    int rK = 0;     ///< Najmniejsze r w bloku K (gdy c != -1)
+    int pK = 0;     ///< Suma p w bloku K (gdy c != -1)
+    int qK = 0;     ///< Najmniejsze q w bloku K (gdy c != -1)
+};
+
+CriticalPath analyzeSchedule(const Instance &instance, const int *order, int *head = nullptr, int *tail = nullptr);
+
+CriticalPath criticalBlock(const Instance &instance, const int *order, const int *completion, int Cmax);
+
+#endif //CRITICAL_PATH_H
@@ -0,0 +1,87 @@
+#ifndef INCUMBENT_H
+#define INCUMBENT_H
+
+#include <atomic>
+#include <climits>
+#include <mutex>
+#include <vector>
+#include "anytime.h"
+
+/**
+ * @class Incumbent
+ * @brief Najlepsze znane rozwiązanie współdzielone przez wątki przeszukiwania.
+ *
+ * Wartość Cmax jest zmienną atomową obniżaną pętlą CAS, więc odczyt do odcinania gałęzi nie blokuje.
+ * Permutacja zapisywana jest pod muteksem tylko przy faktycznej poprawie, co zdarza się rzadko;
+ * wtedy też (pod tym samym muteksem) wywoływane jest AnytimeControl::improved.
+ */
+class Incumbent {
+private:
+    std::atomic<int> value{INT_MAX}; ///< Najlepszy znany Cmax
+    std::mutex mutex;                ///< Chroni order/orderCmax
+    std::vector<int> order;          ///< Permutacja odpowiadająca orderCmax
+    int orderCmax = INT_MAX;         ///< Wartość Cmax zapisanej permutacji
+    const AnytimeControl *control;   ///< Odbiorca powiadomień o poprawie (nullptr - brak)
+
+public:
+    /**
+     * @brief Tworzy puste rozwiązanie
+     * @param control Sterowanie, któremu zgłaszane są kolejne poprawy (nullptr - brak)
+     */
+    explicit Incumbent(const AnytimeControl *control = nullptr) : control(control) {}
+
+    /**
+     * @brief Zwraca najlepszy znany Cmax (bez blokad)
+     * @return Najlepszy Cmax albo INT_MAX, jeśli nic jeszcze nie znaleziono
+     */
+    int load() const { return value.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Zgłasza rozwiązanie; zapisuje je, jeśli jest lepsze od dotychczasowego.
+     * @param Cmax Wartość Cmax rozwiązania
+     * @param first Początek permutacji
+     * @param last Koniec permutacji
+     * @return true jeśli rozwiązanie poprawiło najlepszy wynik
+     */
+    bool offer(int Cmax, const int *first, const int *last) {
+        int current = value.load(std::memory_order_relaxed);
+        while (Cmax < current && !value.compare_exchange_weak(current, Cmax, std::memory_order_relaxed)) {
+        }
+        if (Cmax >= current) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (Cmax < orderCmax) {
+            orderCmax = Cmax;
+            order.assign(first, last);
+            if (control) {
+                control->improved(Cmax, order);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Zgłasza rozwiązanie zapisane w wektorze.
+     * @param Cmax Wartość Cmax rozwiązania
+     * @param permutation Permutacja zadań
+     * @return true jeśli rozwiązanie poprawiło najlepszy wynik
+     */
+    bool offer(int Cmax, const std::vector<int> &permutation) {
+        return offer(Cmax, permutation.data(), permutation.data() + permutation.size());
+    }
+
+    /**
+     * @brief Kopiuje najlepszą permutację.
+     * @param out Wektor wyjściowy
+     * @return Cmax zwróconej permutacji (INT_MAX, jeśli nic nie znaleziono)
+     */
+    int best(std::vector<int> &out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        out = order;
+        return orderCmax;
+    }
+};
+
+#endif //INCUMBENT_H
@@ -0,0 +1,77 @@
+#ifndef INSTANCE_H
+#define INSTANCE_H
+
+#include <memory>
+#include <vector>
+#include "task_struct.h"
+
+/**
+ * @class Instance
+ * @brief Niezmienna instancja problemu 1|r_j,q_j|Cmax współdzielona przez wszystkie algorytmy.
+ *
+ * Dane przechowywane są w układzie kolumnowym (osobne tablice r, p, q). Kopiowanie obiektu
+ * kopiuje tylko wskaźniki i licznik referencji - wszystkie kopie korzystają z tych samych danych.
+ * Zadanie identyfikowane jest indeksem 0..n-1; algorytmy zwracają permutacje tych indeksów.
+ */
+class Instance {
+private:
+    int n = 0;                              ///< Liczba zadań
+    const int *rData = nullptr;             ///< Czasy dostępności
+    const int *pData = nullptr;             ///< Czasy przetwarzania
+    const int *qData = nullptr;             ///< Czasy dostarczenia
+    std::shared_ptr<const void> storage;    ///< Właściciel danych (pusty dla widoków)
+
+public:
+    /**
+     * @brief Tworzy pustą instancję
+     */
+    Instance() = default;
+
+    /**
+     * @brief Tworzy instancję z wektora zadań (jedyna alokacja - wspólny bufor na trzy kolumny)
+     * @param tasks Wektor zadań; kolejność wyznacza indeksy zadań
+     */
+    explicit Instance(const std::vector<task> &tasks);
+
+    /**
+     * @brief Tworzy widok na cudze kolumny bez kopiowania i bez alokacji.
+     * Dane muszą żyć dłużej niż widok.
+     * @param n Liczba zadań
+     * @param r Czasy dostępności
+     * @param p Czasy przetwarzania
+     * @param q Czasy dostarczenia
+     * @return Instancja wskazująca na podane tablice
+     */
+    static Instance borrow(int n, const int *r, const int *p, const int *q);
+
+    /**
+     * @brief Tworzy instancję na kolumnach, których czas życia wyznacza podany właściciel.
+     * @param n Liczba zadań
+     * @param r Czasy dostępności
+     * @param p Czasy przetwarzania
+     * @param q Czasy dostarczenia
+     * @param owner Obiekt utrzymujący kolumny przy życiu (bufor, odwzorowany plik...)
+     * @return Instancja współdzieląca własność z owner
+     */
+    static Instance adopt(int n, const int *r, const int *p, const int *q, std::shared_ptr<const void> owner);
+
+    /**
+     * @brief Zwraca liczbę zadań
+     * @return Liczba zadań w instancji
+     */
+    int size() const { return n; }
+
+    bool empty() const { return n == 0; }
+
+    const int *r() const { return rData; }
+    const int *p() const { return pData; }
+    const int *q() const { return qData; }
+
+    /**
+     * @brief Odtwarza wektor zadań (z identyfikatorami 1..n)
+     * @return Kopia danych jako std::vector<task>
+     */
+    std::vector<task> toTasks() const;
+};
+
+#endif //INSTANCE_H
@@ -0,0 +1,50 @@
+#ifndef INSTANCE_GENERATOR_H
+#define INSTANCE_GENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include "instance_io.h"
+
+/**
+ * @brief Rozkład parametrów generowanych zadań.
+ */
+enum class TaskDistribution {
+    Uniform,     ///< r i q niezależne, jednostajne na [1, W]
+    Correlated,  ///< r i q rosną razem z p (część przedziału [1, W] wyznacza p, reszta jest losowa)
+    Tight        ///< Wąskie okna: r tuż przed losowym środkiem c zadania, q tuż przed W - c (r + q bliskie W)
+};
+
+/**
+ * @brief Format pliku wynikowego generatora.
+ */
+enum class InstanceFormat {
+    Text,   ///< Format .dat: liczba zadań, potem wiersze "r p q"
+    Binary  ///< Format z binary_instance.h (kolumny r, p, q)
+};
+
+/**
+ * @brief Parametry generatora instancji 1|r_j,q_j|Cmax.
+ *
+ * Okno r i q to W = window * n * (pMin + pMax) / 2, czyli ułamek oczekiwanej sumy czasów
+ * przetwarzania; window < 0 oznacza wartość domyślną rozkładu (1.0, a dla Tight 0.7).
+ */
+struct GeneratorOptions {
+    long n = 1000;                                     ///< Liczba zadań
+    uint64_t seed = 2025;                              ///< Ziarno (to samo ziarno - ten sam plik)
+    TaskDistribution distribution = TaskDistribution::Uniform;
+    int pMin = 1;                                      ///< Zakres czasów przetwarzania
+    int pMax = 100;
+    double window = -1;                                ///< Szerokość okna r/q jako ułamek sumy p
+    double correlation = 0.8;                          ///< Udział p w r i q (Correlated), 0..1
+    int threadCount = 0;                               ///< Liczba wątków (0 - liczba rdzeni)
+};
+
+int releaseWindow(const GeneratorOptions &options);
+
+void generateTasks(const GeneratorOptions &options, long first, long count, int *r, int *p, int *q);
+
+LoadResult generateInstance(const GeneratorOptions &options);
+
+std::string writeGeneratedInstance(const GeneratorOptions &options, const std::string &path, InstanceFormat format);
+
+#endif //INSTANCE_GENERATOR_H
@@ -0,0 +1,35 @@
+#ifndef INSTANCE_IO_H
+#define INSTANCE_IO_H
+
+#include <string>
+#include "instance.h"
+
+/**
+ * @brief Wynik wczytywania instancji - instancja albo opis błędu.
+ */
+struct LoadResult {
+    Instance instance;  ///< Wczytana instancja (pusta w razie błędu)
+    std::string error;  ///< Opis błędu; pusty, jeśli wczytanie się powiodło
+
+    explicit operator bool() const { return error.empty(); }
+};
+
+/**
+ * @brief Wynik wczytywania wartości wzorcowej (plik .out) - wartość albo opis błędu.
+ */
+struct OutcomeResult {
+    int value = -1;     ///< Wczytana wartość Cmax (-1 w razie błędu)
+    std::string error;  ///< Opis błędu; pusty, jeśli wczytanie się powiodło
+
+    explicit operator bool() const { return error.empty(); }
+};
+
+LoadResult parseInstance(const char *begin, const char *end);
+
+LoadResult loadInstance(const std::string &path);
+
+OutcomeResult readCorrectOutcome(const std::string &path);
+
+std::string saveBinaryInstance(const Instance &instance, const std::string &path);
+
+#endif //INSTANCE_IO_H
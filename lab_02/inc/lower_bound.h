@@ -0,0 +1,33 @@
+#ifndef LOWER_BOUND_H
+#define LOWER_BOUND_H
+
+#include <algorithm>
+#include "critical_path.h"
+#include "instance.h"
+#include "scratch_arena.h"
+
+/**
+ * @brief Dolne ograniczenia Cmax dla problemu 1|r_j,q_j|Cmax.
+ */
+struct LowerBounds {
+    int preemptive = 0;  ///< Schrage z wywłaszczaniem (optimum problemu z przerwaniami)
+    int singleJob = 0;   ///< max po zadaniach r_j + p_j + q_j
+    int block = 0;       ///< max po zbiorach K: min r + suma p + min q (przeglądanie progów r i q)
+
+    /**
+     * @brief Najsilniejsze z ograniczeń
+     */
+    int best() const { return std::max({preemptive, singleJob, block}); }
+};
+
+int singleJobBound(const Instance &instance);
+
+int blockSweepBound(const Instance &instance, ScratchArena &arena);
+
+int criticalBlockBound(const Instance &instance, const int *order, const CriticalPath &path);
+
+LowerBounds lowerBounds(const Instance &instance, ScratchArena &arena);
+
+double optimalityGap(int Cmax, int lowerBound);
+
+#endif //LOWER_BOUND_H
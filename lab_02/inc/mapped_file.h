@@ -0,0 +1,38 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief Plik odwzorowany w pamięci tylko do odczytu (mmap), zwalniany wraz z ostatnim wskaźnikiem.
+ */
+class MappedFile {
+private:
+    const char *bytes = nullptr; ///< Początek odwzorowania (nullptr dla pustego pliku)
+    size_t length = 0;           ///< Rozmiar pliku w bajtach
+
+    MappedFile(const char *bytes, size_t length) : bytes(bytes), length(length) {}
+
+public:
+    /**
+     * @brief Odwzorowuje plik w pamięci
+     * @param path Ścieżka do pliku
+     * @param error Otrzymuje opis błędu, jeśli pliku nie da się otworzyć lub odwzorować
+     * @return Odwzorowany plik albo nullptr w razie błędu
+     */
+    static std::shared_ptr<const MappedFile> open(const std::string &path, std::string &error);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    const char *data() const { return bytes; }
+
+    size_t size() const { return length; }
+};
+
+#endif //MAPPED_FILE_H
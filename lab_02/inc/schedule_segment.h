@@ -0,0 +1,40 @@
+#ifndef SCHEDULE_SEGMENT_H
+#define SCHEDULE_SEGMENT_H
+
+#include <algorithm>
+#include <climits>
+
+/// "Minus nieskończoność" - na tyle daleko od INT_MIN, że dodanie czasów nie przepełnia int
+constexpr int SEGMENT_NEG = INT_MIN / 4;
+
+/**
+ * @brief Fragment permutacji opisany jako funkcja czasu t, w którym maszyna zwalnia się przed nim.
+ *
+ * Ostatnie zadanie fragmentu kończy się w max(t + P, R), a największe C_j + q_j we fragmencie
+ * wynosi max(t + B, A). Złożenie dwóch fragmentów ma tę samą postać (i jest łączne, a pusty
+ * fragment jest jego elementem neutralnym), więc cztery liczby wystarczają, żeby w O(1) doliczyć
+ * dowolny fragment do znanego początku harmonogramu.
+ */
+struct Segment {
+    int P; ///< Suma czasów przetwarzania
+    int R; ///< Najwcześniejszy koniec fragmentu wynikający z czasów dostępności
+    int B; ///< Największe C_j + q_j względem t
+    int A; ///< Największe C_j + q_j wynikające z czasów dostępności
+
+    static Segment empty() { return {0, SEGMENT_NEG, SEGMENT_NEG, SEGMENT_NEG}; }
+
+    static Segment job(int r, int p, int q) { return {p, r + p, p + q, r + p + q}; }
+
+    /**
+     * @brief Składa fragment z następującym po nim fragmentem next
+     */
+    Segment then(const Segment &next) const {
+        return {P + next.P, std::max(R + next.P, next.R), std::max(B, P + next.B), std::max({A, R + next.B, next.A})};
+    }
+
+    int end(int t) const { return std::max(t + P, R); }
+
+    int value(int t) const { return std::max(t + B, A); }
+};
+
+#endif //SCHEDULE_SEGMENT_H
@@ -0,0 +1,112 @@
+#ifndef SCRATCH_ARENA_H
+#define SCRATCH_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class ScratchArena
+ * @brief Wielokrotnego użytku pamięć robocza algorytmu (alokator "bump" ze znacznikami).
+ *
+ * Algorytm pobiera z areny tablice robocze zamiast tworzyć std::vector. Gdy bieżący blok się
+ * skończy, arena dokłada nowy; reset() scala wszystkie bloki w jeden o łącznym rozmiarze, więc
+ * po pierwszym (rozgrzewkowym) uruchomieniu kolejne uruchomienia nie alokują pamięci wcale.
+ * Arena obsługuje tylko typy trywialne (int, uint64_t, task...) - nie wywołuje konstruktorów.
+ */
+class ScratchArena {
+public:
+    /**
+     * @brief Pozycja w arenie, do której można wrócić funkcją rewind()
+     */
+    struct Mark {
+        size_t block;  ///< Indeks bloku
+        size_t offset; ///< Przesunięcie w bloku
+    };
+
+    class Scope;
+
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> data; ///< Pamięć bloku
+        size_t size;                        ///< Rozmiar bloku w bajtach
+    };
+
+    std::vector<Block> blocks;  ///< Bloki pamięci (zwykle jeden po rozgrzewce)
+    size_t current = 0;         ///< Indeks bieżącego bloku
+    size_t offset = 0;          ///< Zajęta część bieżącego bloku
+
+    void *allocateBytes(size_t bytes, size_t alignment);
+
+public:
+    ScratchArena() = default;
+
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    /**
+     * @brief Przydziela niezainicjalizowaną tablicę count elementów typu T
+     * @param count Liczba elementów
+     * @return Wskaźnik na pierwszy element (ważny do rewind()/reset())
+     */
+    template<typename T>
+    T *allocate(size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value && std::is_trivially_destructible<T>::value,
+                      "ScratchArena obsługuje tylko typy trywialne");
+        return static_cast<T *>(allocateBytes(count * sizeof(T), alignof(T) < 64 ? 64 : alignof(T)));
+    }
+
+    /**
+     * @brief Zwraca bieżącą pozycję w arenie
+     * @return Znacznik do późniejszego rewind()
+     */
+    Mark mark() const { return {current, offset}; }
+
+    /**
+     * @brief Zwalnia (logicznie) wszystko, co przydzielono po znaczniku; powrót na sam początek działa jak reset()
+     * @param position Znacznik zwrócony wcześniej przez mark()
+     */
+    void rewind(Mark position) {
+        if (position.block == 0 && position.offset == 0) {
+            reset();
+            return;
+        }
+        current = position.block;
+        offset = position.offset;
+    }
+
+    /**
+     * @brief Zwalnia (logicznie) całą arenę; jeśli było kilka bloków, scala je w jeden
+     */
+    void reset();
+
+    /**
+     * @brief Zwraca łączny rozmiar bloków w bajtach
+     * @return Pojemność areny
+     */
+    size_t capacity() const;
+};
+
+/**
+ * @class ScratchArena::Scope
+ * @brief Zapamiętuje pozycję areny i przywraca ją przy wyjściu z zakresu.
+ *
+ * Każdy algorytm otwiera własny zakres, dzięki czemu może być wywołany z wnętrza innego
+ * algorytmu korzystającego z tej samej areny (np. Schrage w węzłach algorytmu Carliera).
+ */
+class ScratchArena::Scope {
+private:
+    ScratchArena &arena;
+    Mark start;
+
+public:
+    explicit Scope(ScratchArena &arena) : arena(arena), start(arena.mark()) {}
+
+    ~Scope() { arena.rewind(start); }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+};
+
+#endif //SCRATCH_ARENA_H
@@ -0,0 +1,38 @@
+#ifndef SPLIT_MIX_H
+#define SPLIT_MIX_H
+
+#include <cstdint>
+
+/// Przyrost stanu splitmix64 (złoty podział 2^64)
+constexpr uint64_t SPLIT_MIX_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+/**
+ * @brief Funkcja mieszająca splitmix64: ta sama liczba daje zawsze ten sam wynik
+ */
+inline uint64_t splitMix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Generator splitmix64 - szybki, deterministyczny i niezależny od biblioteki standardowej;
+ * wystarcza do losowania ruchów i operatorów w metaheurystykach
+ */
+struct SplitMix64 {
+    uint64_t state;
+
+    uint64_t next() { return splitMix64(state += SPLIT_MIX_GAMMA); }
+
+    /**
+     * @brief Liczba z przedziału [0, bound)
+     */
+    int below(int bound) { return static_cast<int>(((next() >> 32) * static_cast<uint64_t>(bound)) >> 32); }
+
+    /**
+     * @brief Liczba z przedziału [0, 1)
+     */
+    double unit() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+};
+
+#endif //SPLIT_MIX_H
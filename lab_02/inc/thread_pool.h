@@ -0,0 +1,60 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ThreadPool
+ * @brief Prosta pula wątków ze wspólną kolejką zadań.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;         ///< Wątki robocze
+    std::deque<std::function<void()>> jobs;   ///< Zadania oczekujące na wykonanie
+    std::mutex mutex;                         ///< Chroni kolejkę i liczniki
+    std::condition_variable jobAvailable;     ///< Budzi wątki, gdy pojawi się zadanie
+    std::condition_variable allDone;          ///< Budzi wait(), gdy wszystko zostanie wykonane
+    size_t active = 0;                        ///< Liczba zadań w trakcie wykonania
+    bool stopping = false;                    ///< Ustawiane w destruktorze
+
+    void workerLoop();
+
+public:
+    /**
+     * @brief Tworzy pulę z podaną liczbą wątków (0 oznacza liczbę rdzeni).
+     * @param threadCount Liczba wątków roboczych
+     */
+    explicit ThreadPool(int threadCount = 0);
+
+    /**
+     * @brief Czeka na zakończenie wszystkich zadań i zatrzymuje wątki.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Dodaje zadanie do kolejki.
+     * @param job Funkcja do wykonania w jednym z wątków puli
+     */
+    void submit(std::function<void()> job);
+
+    /**
+     * @brief Blokuje do momentu, aż kolejka będzie pusta i żadne zadanie nie będzie wykonywane.
+     */
+    void wait();
+
+    /**
+     * @brief Zwraca liczbę wątków roboczych
+     * @return Liczba wątków w puli
+     */
+    int size() const { return static_cast<int>(workers.size()); }
+};
+
+#endif //THREAD_POOL_H
@@ -0,0 +1,54 @@
+#ifndef WSPT_TUNER_H
+#define WSPT_TUNER_H
+
+#include <vector>
+#include "alg_03_wspt.h"
+#include "instance.h"
+
+/**
+ * @brief Sposób przeszukiwania przestrzeni wag WSPT.
+ */
+enum class WsptSearch {
+    Grid,          ///< Równomierna siatka wag q (i r)
+    GoldenSection  ///< Złoty podział w kilku przedziałach wagi q naraz (dla każdej wartości r z siatki)
+};
+
+/**
+ * @brief Parametry strojenia wag WSPT.
+ */
+struct WsptTunerOptions {
+    WsptSearch search = WsptSearch::Grid;
+    double qMin = 0.0;          ///< Zakres wagi q
+    double qMax = 2.0;
+    int qSteps = 41;            ///< Liczba punktów siatki wagi q (Grid)
+    bool tuneR = false;         ///< Czy stroić także wagę r (inaczej r = 0)
+    double rMin = -1.0;         ///< Zakres wagi r (gdy tuneR)
+    double rMax = 1.0;
+    int rSteps = 21;            ///< Liczba punktów siatki wagi r (gdy tuneR, w obu sposobach przeszukiwania)
+    int goldenBrackets = 8;     ///< Liczba przedziałów wagi q przeszukiwanych złotym podziałem (GoldenSection)
+    int goldenIterations = 30;  ///< Liczba kroków złotego podziału w każdym przedziale
+    int threadCount = 0;        ///< Liczba wątków (0 - liczba rdzeni)
+};
+
+/**
+ * @brief Wynik strojenia wag WSPT.
+ */
+struct WsptTuning {
+    WsptWeights weights;      ///< Najlepsze znalezione wagi
+    double score = 0;         ///< Średnie Cmax / dolne ograniczenie po instancjach dla tych wag
+    int Cmax = 0;             ///< Cmax dla najlepszych wag (tylko strojenie pojedynczej instancji)
+    long evaluations = 0;     ///< Liczba ocenionych zestawów wag
+    double seconds = 0;       ///< Czas strojenia
+
+    /**
+     * @brief Przepustowość: ocenione zestawy wag na sekundę
+     */
+    double evaluationsPerSecond() const { return seconds > 0 ? evaluations / seconds : 0; }
+};
+
+WsptTuning tuneWsptWeights(const std::vector<const Instance *> &family, const WsptTunerOptions &options = WsptTunerOptions());
+
+WsptTuning tuneWsptWeights(const Instance &instance, std::vector<int> &order,
+                           const WsptTunerOptions &options = WsptTunerOptions());
+
+#endif //WSPT_TUNER_H
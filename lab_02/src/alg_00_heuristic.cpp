@@ -1,70 +1,203 @@
 #include "alg_00_heuristic.h"
 #include <vector>
 #include <algorithm>
-#include "task_struct.h"
+#include <cstdint>
+#include "cmax_eval.h"
 
 /**
- * @brief Sortuje zadania według czasu dostępności (rj) i oblicza maksymalny czas zakończenia (Cmax).
+ * @brief Sortuje klucze (wartość sortująca w starszych 32 bitach, indeks zadania w młodszych)
+ * i zapisuje wynikową kolejność indeksów.
+ */
+static void sortedOrder(uint64_t *keys, int n, std::vector<int> &order) {
+    std::sort(keys, keys + n);
+    order.resize(n);
+    for (int i = 0; i < n; i++) {
+        order[i] = static_cast<int>(static_cast<uint32_t>(keys[i]));
+    }
+}
+
+/// Poniżej tylu zadań koszt tablic liczników przewyższa zysk - sortujemy porównaniami
+constexpr int RADIX_SORT_MIN_TASKS = 4096;
+
+/// Liczba bitów cyfry sortowania pozycyjnego (tablica liczników 2^11 mieści się w L1)
+constexpr int RADIX_BITS = 11;
+constexpr uint32_t RADIX = 1u << RADIX_BITS;
+
+/**
+ * @brief Stabilnie sortuje indeksy 0..n-1 według 32-bitowych kluczy i zapisuje je w order.
  *
- * @param tasks Wektor zadań do posortowania i zaplanowania.
- * @return int Maksymalny czas zakończenia (Cmax).
+ * Małe instancje sortowane są porównaniami (sortedOrder). Gdy klucze nie przekraczają 2n, wystarcza
+ * jeden przebieg sortowania przez zliczanie. W przeciwnym razie
+ * sortowanie pozycyjne LSD z cyframi 11-bitowymi: histogramy wszystkich cyfr liczone są w jednym
+ * przebiegu, a cyfry powyżej najstarszego bitu największego klucza są pomijane. Klucze przenoszone są
+ * razem z indeksami, żeby kolejne przebiegi czytały pamięć sekwencyjnie. Stabilność daje tę samą
+ * kolejność remisów (rosnące indeksy) co sortowanie kluczy z indeksem w młodszych bitach.
  */
-int rjSortPlaning(std::vector<task> tasks) {
-    // Sortowanie zadań według czasu dostępności (rj)
-    std::sort(tasks.begin(), tasks.end(),  [](const task& a, const task& b)  {
-        return a.r < b.r;
-    });
+static void radixSortedOrder(uint32_t *keys, int n, ScratchArena &arena, std::vector<int> &order) {
+    if (n < RADIX_SORT_MIN_TASKS) {
+        uint64_t *packed = arena.allocate<uint64_t>(n);
+        for (int i = 0; i < n; i++) {
+            packed[i] = (static_cast<uint64_t>(keys[i]) << 32) | static_cast<uint32_t>(i);
+        }
+        sortedOrder(packed, n, order);
+        return;
+    }
 
-    // Obliczanie Cmax (maksymalnego czasu zakończenia)
-    int currentTime = 0;  // Aktualny czas
-    int Cmax = 0;  // Maksymalny czas zakończenia
+    order.resize(n);
+    uint32_t maxKey = 0;
+    for (int i = 0; i < n; i++) {
+        maxKey = std::max(maxKey, keys[i]);
+    }
 
-    for (const auto& t : tasks) {
-        // Jeśli zadanie nie jest jeszcze dostępne, czekamy
-        if (currentTime < t.r) {
-            currentTime = t.r;
+    if (maxKey <= 2 * static_cast<uint32_t>(n)) {
+        uint32_t *count = arena.allocate<uint32_t>(maxKey + 2);
+        std::fill(count, count + maxKey + 2, 0);
+        for (int i = 0; i < n; i++) {
+            count[keys[i] + 1]++;
         }
+        for (uint32_t k = 1; k <= maxKey; k++) {
+            count[k] += count[k - 1];
+        }
+        for (int i = 0; i < n; i++) {
+            order[count[keys[i]]++] = i;
+        }
+        return;
+    }
 
-        // Wykonujemy zadanie
-        currentTime += t.p;
+    int bits = 0;
+    while (bits < 32 && (maxKey >> bits) != 0) {
+        bits++;
+    }
+    const int passes = (bits + RADIX_BITS - 1) / RADIX_BITS;
 
-        // Aktualizujemy maksymalny czas zakończenia
-        int completionTime = currentTime + t.q;
-        Cmax = std::max(Cmax, completionTime);
+    uint32_t *histogram = arena.allocate<uint32_t>(passes * RADIX);
+    std::fill(histogram, histogram + passes * RADIX, 0);
+    for (int i = 0; i < n; i++) {
+        for (int d = 0; d < passes; d++) {
+            histogram[d * RADIX + ((keys[i] >> (d * RADIX_BITS)) & (RADIX - 1))]++;
+        }
+    }
+    for (int d = 0; d < passes; d++) {
+        uint32_t sum = 0;
+        for (uint32_t k = 0; k < RADIX; k++) {
+            const uint32_t count = histogram[d * RADIX + k];
+            histogram[d * RADIX + k] = sum;
+            sum += count;
+        }
     }
 
-    return Cmax;
+    // Pierwszy przebieg czyta indeksy wprost z pętli, ostatni zapisuje je od razu do order
+    uint32_t *srcKeys = keys, *dstKeys = arena.allocate<uint32_t>(n);
+    int *srcIndex = arena.allocate<int>(n), *dstIndex = arena.allocate<int>(n);
+    for (int d = 0; d < passes; d++) {
+        uint32_t *offset = histogram + d * RADIX;
+        const int shift = d * RADIX_BITS;
+        const bool last = d == passes - 1;
+        int *target = last ? order.data() : dstIndex;
+        for (int i = 0; i < n; i++) {
+            const uint32_t position = offset[(srcKeys[i] >> shift) & (RADIX - 1)]++;
+            target[position] = d == 0 ? i : srcIndex[i];
+            if (!last) {
+                dstKeys[position] = srcKeys[i];
+            }
+        }
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcIndex, dstIndex);
+    }
+}
+
+/**
+ * @brief Sortuje zadania według czasu dostępności (rj) i oblicza maksymalny czas zakończenia (Cmax).
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań.
+ * @return int Maksymalny czas zakończenia (Cmax).
+ */
+int rjSortPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+
+    // Sortowanie zadań według czasu dostępności (rj)
+    uint64_t *keys = arena.allocate<uint64_t>(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = (static_cast<uint64_t>(static_cast<uint32_t>(instance.r()[i])) << 32) | static_cast<uint32_t>(i);
+    }
+    sortedOrder(keys, n, order);
+
+    // Obliczanie Cmax (maksymalnego czasu zakończenia)
+    return evaluateCmax(instance, order.data());
 }
 
 /**
  * @brief Sortuje zadania według czasu zakończenia (qj) malejąco i oblicza maksymalny czas zakończenia (Cmax).
  *
- * @param tasks Wektor zadań do posortowania i zaplanowania.
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań.
  * @return int Maksymalny czas zakończenia (Cmax).
  */
-int qjSortPlaning(std::vector<task> tasks) {
+int qjSortPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+
     // Sortowanie zadań według czasu zakończenia (qj) malejąco
-    std::sort(tasks.begin(), tasks.end(), [](const task& a, const task& b) {
-       return a.q > b.q;
-   });
+    uint64_t *keys = arena.allocate<uint64_t>(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = (static_cast<uint64_t>(UINT32_MAX - static_cast<uint32_t>(instance.q()[i])) << 32) |
+                  static_cast<uint32_t>(i);
+    }
+    sortedOrder(keys, n, order);
 
     // Obliczanie Cmax (maksymalnego czasu zakończenia)
-    int currentTime = 0;  // Aktualny czas
-    int Cmax = 0;  // Maksymalny czas zakończenia
+    return evaluateCmax(instance, order.data());
+}
 
-    for (const auto& t : tasks) {
-        // Jeśli zadanie nie jest jeszcze dostępne, czekamy
-        if (currentTime < t.r) {
-            currentTime = t.r;
-        }
+/**
+ * @brief Wariant rjSortPlaning dla dużych instancji: sortowanie pozycyjne 32-bitowych kluczy r.
+ *
+ * Wynik (także kolejność zadań o równym r) jest identyczny jak w rjSortPlaning.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań.
+ * @return int Maksymalny czas zakończenia (Cmax).
+ */
+int rjSortRadixPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
 
-        // Wykonujemy zadanie
-        currentTime += t.p;
+    uint32_t *keys = arena.allocate<uint32_t>(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = static_cast<uint32_t>(instance.r()[i]);
+    }
+    radixSortedOrder(keys, n, arena, order);
+
+    return evaluateCmax(instance, order.data());
+}
+
+/**
+ * @brief Wariant qjSortPlaning dla dużych instancji: sortowanie pozycyjne 32-bitowych kluczy max(q) - q.
+ *
+ * Wynik (także kolejność zadań o równym q) jest identyczny jak w qjSortPlaning.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań.
+ * @return int Maksymalny czas zakończenia (Cmax).
+ */
+int qjSortRadixPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+    const int *q = instance.q();
 
-        // Aktualizujemy maksymalny czas zakończenia
-        int completionTime = currentTime + t.q;
-        Cmax = std::max(Cmax, completionTime);
+    // Malejąco według q = rosnąco według max(q) - q; mniejszy zakres kluczy to mniej przebiegów
+    const uint32_t maxQ = n > 0 ? static_cast<uint32_t>(*std::max_element(q, q + n)) : 0;
+    uint32_t *keys = arena.allocate<uint32_t>(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = maxQ - static_cast<uint32_t>(q[i]);
     }
+    radixSortedOrder(keys, n, arena, order);
 
-    return Cmax;
+    return evaluateCmax(instance, order.data());
 }
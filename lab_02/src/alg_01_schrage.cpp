@@ -1,46 +1,130 @@
 #include "alg_01_schrage.h"
 #include <algorithm>
-#include <queue>
+#include <climits>
+#include <cstdint>
 #include <functional>
 #include <vector>
-#include "task_struct.h"
+#include "instrumentation.h"
+
+namespace {
+
+/**
+ * @brief Sortuje zadania według czasu dostępności (r, przy remisie według indeksu).
+ * @return Tablica z areny: klucz r w starszych 32 bitach, indeks zadania w młodszych
+ */
+uint64_t *sortByRelease(const Instance &instance, ScratchArena &arena) {
+    INSTRUMENT_SCOPE(Prepare);
+    const size_t n = instance.size();
+    const int *r = instance.r();
+    uint64_t *released = arena.allocate<uint64_t>(n);
+    for (size_t i = 0; i < n; i++) {
+        released[i] = (static_cast<uint64_t>(static_cast<uint32_t>(r[i])) << 32) | i;
+    }
+    std::sort(released, released + n);
+    return released;
+}
+
+/**
+ * @brief Zadania posortowane według r i kopiec zadań gotowych - wspólny rdzeń wariantów Schrage
+ * bez wywłaszczania.
+ *
+ * Kopiec przechowuje q w starszych 32 bitach i odwróconą pozycję w kolejności r w młodszych, więc
+ * przy równych q wybierane jest zadanie, które wcześniej trafiło do zbioru gotowych.
+ */
+class ReadyQueue {
+private:
+    const int *q;
+    size_t n;
+    uint64_t *released;         ///< Zadania posortowane według r (sortByRelease)
+    uint64_t *available;        ///< Kopiec zadań gotowych
+    size_t index = 0;           ///< Następne zadanie jeszcze niedostępne
+    size_t availableCount = 0;
+
+public:
+    ReadyQueue(const Instance &instance, ScratchArena &arena)
+            : q(instance.q()), n(instance.size()), released(sortByRelease(instance, arena)),
+              available(arena.allocate<uint64_t>(instance.size())) {}
+
+    bool finished() const { return index == n && availableCount == 0; }
+
+    bool hasReady() const { return availableCount > 0; }
+
+    /**
+     * @brief Najbliższy czas dostępności (wymaga zadania jeszcze niedostępnego)
+     */
+    int nextRelease() const { return static_cast<int>(released[index] >> 32); }
+
+    /**
+     * @brief Dodaje do zbioru gotowych wszystkie zadania dostępne w chwili time
+     */
+    void release(int time) {
+        while (index < n && static_cast<int>(released[index] >> 32) <= time) {
+            uint32_t taskIndex = static_cast<uint32_t>(released[index]);
+            available[availableCount++] = (static_cast<uint64_t>(static_cast<uint32_t>(q[taskIndex])) << 32) |
+                                          (UINT32_MAX - static_cast<uint32_t>(index));
+            std::push_heap(available, available + availableCount);
+            INSTRUMENT_COUNT(HeapPush);
+            index++;
+        }
+    }
+
+    /**
+     * @brief Zdejmuje gotowe zadanie z największym q (wymaga niepustego zbioru gotowych)
+     * @return Indeks zadania
+     */
+    int pop() {
+        std::pop_heap(available, available + availableCount);
+        INSTRUMENT_COUNT(HeapPop);
+        uint32_t position = UINT32_MAX - static_cast<uint32_t>(available[--availableCount]);
+        return static_cast<int>(static_cast<uint32_t>(released[position]));
+    }
+};
+
+} // namespace
 
 /**
  * @brief Funkcja schragePlaning implementuje heurystyczne podejście do problemu harmonogramowania zadań.
  * Zadania są sortowane według czasu dostępności (r), a następnie wybierane jest zadanie z największym czasem zakończenia (q).
  *
- * @param tasks Wektor zadań do przetworzenia
+ * Zadania są porządkowane według czasu dostępności (r, a przy remisie według indeksu), a zbiór zadań
+ * gotowych jest kopcem (ReadyQueue), więc całość działa w czasie O(n log n). Przy równych q wybierane jest zadanie,
+ * które wcześniej trafiło do zbioru gotowych. Tablice robocze pochodzą z areny.
+ * Przy włączonej instrumentacji (instrumentation.h) zliczane są operacje na kopcu i przeskoki zegara
+ * przy bezczynności, a sortowanie i pętla szeregowania mierzone są jako osobne fazy.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Tablica wyjściowa na instance.size() indeksów (kolejność wykonania) albo nullptr.
  * @return Maksymalny czas zakończenia (Cmax) wszystkich zadań.
  */
-int schragePlaning(std::vector<task> tasks) {
-    // Sortowanie zadań według czasu dostępności (r)
-    std::sort(tasks.begin(), tasks.end(), [](const task &a, const task &b) { return a.r < b.r; });
+int schragePlaning(const Instance &instance, ScratchArena &arena, int *order) {
+    ScratchArena::Scope scope(arena);
+    const int *p = instance.p(), *q = instance.q();
+    ReadyQueue ready(instance, arena);
 
     int currentTime = 0, Cmax = 0;
-    std::vector<task> available;
-    int index = 0;
+    size_t scheduled = 0;
 
     // Główna pętla przetwarzająca zadania
-    while (index < tasks.size() || !available.empty()) {
-        // Dodawanie zadań dostępnych w bieżącym czasie do listy dostępnych zadań
-        while (index < tasks.size() && tasks[index].r <= currentTime) {
-            available.push_back(tasks[index]);
-            index++;
-        }
+    INSTRUMENT_SCOPE(Construct);
+    while (!ready.finished()) {
+        // Dodawanie zadań dostępnych w bieżącym czasie do kopca zadań gotowych
+        ready.release(currentTime);
 
-        if (!available.empty()) {
+        if (ready.hasReady()) {
             // Wybór zadania z największym czasem zakończenia (q)
-            auto it = std::max_element(available.begin(), available.end(),
-                                       [](const task &a, const task &b) { return a.q < b.q; });
-            task currentTask = *it;
-            available.erase(it);
+            const int taskIndex = ready.pop();
+            if (order) {
+                order[scheduled++] = taskIndex;
+            }
 
             // Aktualizacja bieżącego czasu i maksymalnego czasu zakończenia
-            currentTime += currentTask.p;
-            Cmax = std::max(Cmax, currentTime + currentTask.q);
-        } else if (index < tasks.size()) {
+            currentTime += p[taskIndex];
+            Cmax = std::max(Cmax, currentTime + q[taskIndex]);
+        } else {
             // Jeśli nie ma dostępnych zadań, przesuń bieżący czas do czasu dostępności następnego zadania
-            currentTime = tasks[index].r;
+            currentTime = ready.nextRelease();
+            INSTRUMENT_COUNT(IdleJump);
         }
     }
 
@@ -48,74 +132,255 @@ int schragePlaning(std::vector<task> tasks) {
 }
 
 /**
- * @brief Funkcja schragePreemptivePlaning implementuje heurystyczne podejście do problemu harmonogramowania zadań
- * z wywłaszczeniem. Zadania są sortowane według czasu dostępności (r), a następnie wybierane jest zadanie
- * z największym czasem zakończenia (q), z możliwością przerwania.
+ * @brief Algorytm Schrage zwracający kolejność wykonania w wektorze.
  *
- * @param tasks Wektor zadań do przetworzenia, gdzie każde zadanie ma pola r (czas dostępności), p (czas przetwarzania)
- * i q (czas zakończenia).
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań.
  * @return Maksymalny czas zakończenia (Cmax) wszystkich zadań.
  */
-int schragePreemptivePlaning(std::vector<task> tasks) {
-    // Komparator do sortowania zadań według r (rosnąco)
-    auto cmpR = [](const task &a, const task &b) {
-        return a.r > b.r;
-    };
-
-    // Kolejka priorytetowa N (zadania niegotowe), sortowana według najmniejszego r
-    std::priority_queue<task, std::vector<task>, decltype(cmpR)> N(cmpR);
-
-    // Dodaj wszystkie zadania do kolejki N
-    for (auto &t: tasks) {
-        N.push(t);
+int schragePlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    order.resize(instance.size());
+    return schragePlaning(instance, arena, order.data());
+}
+
+/**
+ * @brief Algorytm Schrage dla m identycznych maszyn równoległych (P|r_j,q_j|Cmax).
+ *
+ * Szeregowanie listowe: zegar to najwcześniejsza chwila, w której zwalnia się któraś maszyna
+ * (szczyt kopca maszyn po czasie zwolnienia); jeśli żadne zadanie nie jest gotowe, zegar przesuwa się
+ * do najbliższego czasu dostępności. Gotowe zadanie o największym q (wspólna z schragePlaning kolejka
+ * ReadyQueue) trafia na maszynę zwalniającą się najwcześniej, przy remisie na tę o mniejszym numerze. Sortowanie
+ * i kopiec zadań kosztują O(n log n), kopiec maszyn O(n log m). Dla m = 1 kolejność i Cmax są
+ * identyczne z schragePlaning.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param machines Liczba maszyn (co najmniej 1).
+ * @param order Tablica wyjściowa na instance.size() indeksów (kolejność przydziału) albo nullptr.
+ * @param machineOf Tablica wyjściowa: machineOf[k] to maszyna zadania order[k] (albo nullptr).
+ * @return Maksymalny czas zakończenia (Cmax) wszystkich zadań.
+ */
+int schrageMachinesPlaning(const Instance &instance, ScratchArena &arena, int machines, int *order, int *machineOf) {
+    ScratchArena::Scope scope(arena);
+    const size_t n = instance.size();
+    const int *p = instance.p(), *q = instance.q();
+    machines = std::max(machines, 1);
+    ReadyQueue ready(instance, arena);
+
+    // Kopiec maszyn (najmniejszy na szczycie): czas zwolnienia w starszych 32 bitach, numer w młodszych
+    uint64_t *freeAt = arena.allocate<uint64_t>(machines);
+    for (int m = 0; m < machines; m++) {
+        freeAt[m] = static_cast<uint64_t>(m);
+    }
+    const auto later = std::greater<uint64_t>();
+
+    int Cmax = 0;
+    size_t scheduled = 0;
+
+    INSTRUMENT_SCOPE(Construct);
+    while (scheduled < n) {
+        // Zegar: najwcześniejsze zwolnienie maszyny, a przy braku gotowych zadań - następny czas dostępności
+        int currentTime = static_cast<int>(freeAt[0] >> 32);
+        if (!ready.hasReady()) {
+            currentTime = std::max(currentTime, ready.nextRelease());
+        }
+        ready.release(currentTime);
+
+        // Zadanie z największym q na maszynę zwalniającą się najwcześniej
+        const int taskIndex = ready.pop();
+        std::pop_heap(freeAt, freeAt + machines, later);
+        const uint32_t machine = static_cast<uint32_t>(freeAt[machines - 1]);
+        const int completion = currentTime + p[taskIndex];
+        freeAt[machines - 1] = (static_cast<uint64_t>(static_cast<uint32_t>(completion)) << 32) | machine;
+        std::push_heap(freeAt, freeAt + machines, later);
+
+        if (order) {
+            order[scheduled] = taskIndex;
+        }
+        if (machineOf) {
+            machineOf[scheduled] = static_cast<int>(machine);
+        }
+        scheduled++;
+        Cmax = std::max(Cmax, completion + q[taskIndex]);
     }
 
-    // Komparator do sortowania zadań według q (malejąco)
-    auto cmpQ = [](const task &a, const task &b) {
-        return a.q < b.q;
-    };
+    return Cmax;
+}
 
-    // Kolejka priorytetowa G (zadania gotowe do wykonania), sortowana po największym q
-    std::priority_queue<task, std::vector<task>, decltype(cmpQ)> G(cmpQ);
+/**
+ * @brief Algorytm Schrage dla m maszyn równoległych zwracający przydział w wektorach.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param machines Liczba maszyn (co najmniej 1).
+ * @param order Wektor wyjściowy - kolejność przydziału jako indeksy zadań.
+ * @param machineOf Wektor wyjściowy - maszyna każdego zadania z order.
+ * @return Maksymalny czas zakończenia (Cmax) wszystkich zadań.
+ */
+int schrageMachinesPlaning(const Instance &instance, ScratchArena &arena, int machines, std::vector<int> &order,
+                           std::vector<int> &machineOf) {
+    order.resize(instance.size());
+    machineOf.resize(instance.size());
+    return schrageMachinesPlaning(instance, arena, machines, order.data(), machineOf.data());
+}
+
+/**
+ * @brief Funkcja schragePreemptivePlaning implementuje algorytm Schrage z wywłaszczeniem.
+ * W każdej chwili wykonywane jest dostępne zadanie z największym czasem dostarczenia (q); nadejście
+ * zadania z większym q przerywa bieżące, które wraca do zbioru gotowych z pozostałym czasem wykonania.
+ *
+ * Symulacja jest sterowana zdarzeniami: zdarzenia dostępności (posortowane po r) przeglądane są
+ * jednokrotnie, zbiór gotowych jest kopcem po q, a czas nigdy się nie cofa. Każdy obrót pętli albo
+ * kończy zadanie, albo dochodzi do zdarzenia dostępności, więc całość działa w czasie O(n log n).
+ * Wynik jest optymalnym Cmax problemu z wywłaszczeniem, czyli dolnym ograniczeniem dla 1|r_j,q_j|Cmax.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @return Maksymalny czas zakończenia (Cmax) wszystkich zadań.
+ */
+int schragePreemptivePlaning(const Instance &instance, ScratchArena &arena) {
+    ScratchArena::Scope scope(arena);
+    const size_t n = instance.size();
+    const int *p = instance.p(), *q = instance.q();
+
+    // Zdarzenia dostępności posortowane według r (klucz r w starszych 32 bitach, indeks w młodszych)
+    const uint64_t *released = sortByRelease(instance, arena);
+
+    // Pozostały czas wykonania, indeksowany pozycją w kolejności zdarzeń
+    int *remaining = arena.allocate<int>(n);
+
+    // Kopiec zadań gotowych: q w starszych 32 bitach, odwrócona pozycja w młodszych
+    uint64_t *ready = arena.allocate<uint64_t>(n);
+    size_t readyCount = 0;
 
     int t = 0; // Aktualny czas
     int Cmax = 0; // Wynik: maksymalny czas zakończenia
-    task current = {0, 0, INT_MAX}; // Aktualnie wykonywane zadanie (na początku żadne)
-
-    // Główna pętla: wykonuj, dopóki są zadania gotowe lub oczekujące
-    while (!G.empty() || !N.empty()) {
-        // Przenosimy do G wszystkie zadania, których czas dostępności <= aktualny czas
-        while (!N.empty() && N.top().r <= t) {
-            task e = N.top();
-            N.pop();
-            G.push(e);
-
-            // Jeśli nowe zadanie ma większe q niż aktualnie wykonywane, wywłaszczamy
-            if (e.q > current.q) {
-                current.p = t - e.r; // przelicz pozostały czas aktualnego zadania
-                t = e.r; // cofamy czas do momentu nadejścia nowego zadania
-                if (current.p > 0) {
-                    G.push(current); // dodajemy przerwane zadanie z powrotem do G
-                }
-            }
+    size_t index = 0; // Następne nieprzetworzone zdarzenie dostępności
+
+    while (index < n || readyCount > 0) {
+        // Jeśli nie ma żadnych zadań gotowych, przejdź do czasu następnego zdarzenia
+        if (readyCount == 0) {
+            t = std::max(t, static_cast<int>(released[index] >> 32));
         }
 
-        // Jeśli nie ma żadnych zadań gotowych, przejdź do czasu następnego dostępnego zadania
-        if (G.empty()) {
-            t = N.top().r;
-        } else {
-            // Wybierz zadanie z największym q do wykonania
-            task e = G.top();
-            G.pop();
-            current = e;
+        // Przenosimy do zbioru gotowych wszystkie zadania, których czas dostępności <= aktualny czas
+        while (index < n && static_cast<int>(released[index] >> 32) <= t) {
+            const uint32_t taskIndex = static_cast<uint32_t>(released[index]);
+            remaining[index] = p[taskIndex];
+            ready[readyCount++] = (static_cast<uint64_t>(static_cast<uint32_t>(q[taskIndex])) << 32) |
+                                  (UINT32_MAX - static_cast<uint32_t>(index));
+            std::push_heap(ready, ready + readyCount);
+            index++;
+        }
 
-            // Wykonujemy zadanie (czas przetwarzania p)
-            t += e.p;
+        // Zadanie z największym q wykonujemy do końca albo do następnego zdarzenia dostępności
+        const uint64_t top = ready[0];
+        const uint32_t position = UINT32_MAX - static_cast<uint32_t>(top);
+        const int nextRelease = index < n ? static_cast<int>(released[index] >> 32) : INT_MAX;
 
-            // Aktualizujemy Cmax
-            Cmax = std::max(Cmax, t + e.q);
+        if (nextRelease - t >= remaining[position]) {
+            std::pop_heap(ready, ready + readyCount--);
+            t += remaining[position];
+            remaining[position] = 0;
+            Cmax = std::max(Cmax, t + static_cast<int>(top >> 32));
+        } else {
+            // Wywłaszczenie możliwe dopiero w chwili nextRelease - zadanie zostaje w kopcu z mniejszym czasem
+            remaining[position] -= nextRelease - t;
+            t = nextRelease;
         }
     }
 
     return Cmax;
 }
+
+namespace {
+
+/**
+ * @brief Porządek kopca zadań niedostępnych: na szczycie najmniejsze r, potem najwcześniej zgłoszone
+ */
+template<typename Entry>
+bool laterRelease(const Entry &a, const Entry &b) {
+    return a.job.r != b.job.r ? a.job.r > b.job.r : a.sequence > b.sequence;
+}
+
+/**
+ * @brief Porządek kopca zadań gotowych: na szczycie największe q, przy remisie kolejność jak w schragePlaning
+ */
+template<typename Entry>
+bool lowerPriority(const Entry &a, const Entry &b) {
+    if (a.job.q != b.job.q) {
+        return a.job.q < b.job.q;
+    }
+    return laterRelease(a, b);
+}
+
+} // namespace
+
+void SchrageDispatcher::reserve(size_t count) {
+    pending.reserve(count);
+    ready.reserve(count);
+}
+
+/**
+ * @brief Przenosi do zbioru gotowych wszystkie zadania z r <= zegar.
+ */
+void SchrageDispatcher::release() {
+    while (!pending.empty() && pending.front().job.r <= clock) {
+        std::pop_heap(pending.begin(), pending.end(), laterRelease<Entry>);
+        ready.push_back(pending.back());
+        pending.pop_back();
+        std::push_heap(ready.begin(), ready.end(), lowerPriority<Entry>);
+    }
+}
+
+/**
+ * @brief Zgłasza nowe zadanie; trafia od razu do zbioru gotowych, jeśli r <= time().
+ *
+ * @param job Zgłaszane zadanie (pole id jest przekazywane z powrotem przez next()).
+ */
+void SchrageDispatcher::submit(const task &job) {
+    Entry entry{job, submitted++};
+    if (job.r <= clock) {
+        ready.push_back(entry);
+        std::push_heap(ready.begin(), ready.end(), lowerPriority<Entry>);
+    } else {
+        pending.push_back(entry);
+        std::push_heap(pending.begin(), pending.end(), laterRelease<Entry>);
+    }
+}
+
+/**
+ * @brief Przesuwa zegar do chwili time (zegar nigdy się nie cofa) i zwalnia zadania, które stały się dostępne.
+ *
+ * Wywołanie w chwili, gdy maszyna jest jeszcze zajęta (time < time()), niczego nie zmienia.
+ *
+ * @param time Bieżący czas.
+ */
+void SchrageDispatcher::advance(int time) {
+    clock = std::max(clock, time);
+    release();
+}
+
+/**
+ * @brief Uruchamia w chwili time() gotowe zadanie o największym q.
+ *
+ * Zegar przesuwa się na moment zakończenia zadania, więc zadanie zaczyna się w time() - p.
+ *
+ * @return Uruchomione zadanie albo brak wartości, jeśli żadne zadanie nie jest gotowe
+ *         (należy wtedy zgłosić zadanie albo przesunąć zegar, np. do nextRelease()).
+ */
+std::optional<task> SchrageDispatcher::next() {
+    if (ready.empty()) {
+        return std::nullopt;
+    }
+
+    std::pop_heap(ready.begin(), ready.end(), lowerPriority<Entry>);
+    const task job = ready.back().job;
+    ready.pop_back();
+
+    clock += job.p;
+    Cmax = std::max(Cmax, clock + job.q);
+    release();
+    return job;
+}
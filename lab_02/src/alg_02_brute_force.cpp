@@ -2,48 +2,227 @@
 #include <algorithm>
 #include <climits>
 #include <vector>
-#include "task_struct.h"
+#include "alg_01_schrage.h"
+#include "incumbent.h"
+#include "instrumentation.h"
+#include "thread_pool.h"
 
 /**
  * @brief Funkcja bruteForce znajduje optymalny harmonogram zadań metodą brute force.
  *
- * @param tasks Wektor zadań, gdzie każde zadanie ma pola r (czas dostępności), p (czas przetwarzania) i q (czas zakończenia).
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - optymalna kolejność wykonania jako indeksy zadań.
  * @return Minimalny czas zakończenia wszystkich zadań (Cmax).
  */
-int bruteForce(std::vector<task> tasks) {
+int bruteForce(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    return bruteForce(instance, arena, order, AnytimeControl());
+}
+
+/**
+ * @brief Brute force z możliwością przerwania.
+ *
+ * Każda lepsza permutacja zgłaszana jest przez control.improved. Po przerwaniu (flaga lub termin,
+ * sprawdzane co 1024 permutacje) zwracana jest najlepsza z dotąd sprawdzonych - zawsze co najmniej
+ * z pierwszej.
+ * Instrumentacja zlicza ocenione permutacje i poprawy.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - najlepsza znaleziona kolejność jako indeksy zadań.
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszej znalezionej permutacji (optymalny, jeśli przegląd nie został przerwany).
+ */
+int bruteForce(const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
     int Cmax = INT_MAX;
 
-    // Sortowanie początkowe wymagane przez "next_permutation"
-    std::sort(tasks.begin(), tasks.end(), [](const task &a, const task &b) {
-        return a.id < b.id;
-    });
+    // Permutacja początkowa (rosnące indeksy) wymagana przez "next_permutation"
+    int *perm = arena.allocate<int>(n);
+    for (int i = 0; i < n; i++) {
+        perm[i] = i;
+    }
+    order.assign(perm, perm + n);
+    AnytimePoller poller(control);
+    INSTRUMENT_SCOPE(Search);
 
     do {
+        INSTRUMENT_COUNT(Evaluation);
         int currentTime = 0;
         int currentCmax = 0;
 
         // Obliczanie czasu zakończenia dla bieżącego harmonogramu
-        for (const auto &t: tasks) {
+        for (int k = 0; k < n; k++) {
+            const int j = perm[k];
+
             // Jeśli zadanie nie jest jeszcze dostępne, czekamy
-            if (currentTime < t.r) {
-                currentTime = t.r;
+            if (currentTime < r[j]) {
+                currentTime = r[j];
             }
 
             // Wykonanie zadania
-            currentTime += t.p;
+            currentTime += p[j];
 
             // Aktualizacja maksymalnego czasu zakończenia
-            int completionTime = currentTime + t.q;
+            int completionTime = currentTime + q[j];
             currentCmax = std::max(currentCmax, completionTime);
         }
 
         // Aktualizacja minimalnego Cmax
         if (currentCmax < Cmax) {
             Cmax = currentCmax;
+            std::copy(perm, perm + n, order.begin());
+            control.improved(Cmax, order);
+            INSTRUMENT_COUNT(Improvement);
         }
-    } while (std::next_permutation(tasks.begin(), tasks.end(), [](const task &a, const task &b) {
-        return a.id < b.id;
-    }));
+    } while (std::next_permutation(perm, perm + n) && !poller.shouldStop());
+
+    return n == 0 ? 0 : Cmax;
+}
+
+namespace {
+
+/**
+ * @brief Dolne ograniczenie Cmax wszystkich uzupełnień prefiksu: częściowy Cmax albo koniec prefiksu
+ * powiększony o czasy przetwarzania pozostałych zadań.
+ */
+inline int prefixBound(int currentTime, int currentCmax, long remainingP) {
+    return static_cast<int>(std::max<long>(currentCmax, currentTime + remainingP));
+}
+
+/**
+ * @brief Przegląd w głąb wszystkich uzupełnień prefiksu perm[0..depth).
+ *
+ * Stan prefiksu (currentTime, currentCmax, suma p pozostałych zadań) jest dziedziczony przez całe
+ * poddrzewo, więc każdy węzeł kosztuje O(1), a liczba węzłów wewnętrznych jest rzędu liczby liści.
+ * Prefiks, którego dolne ograniczenie (prefixBound) nie jest mniejsze od najlepszego znanego wyniku,
+ * jest odcinany. Po przerwaniu (poller) przegląd wraca bez odwiedzania kolejnych węzłów.
+ */
+void enumerateSuffixes(const Instance &instance, std::vector<int> &perm, size_t depth,
+                       int currentTime, int currentCmax, long remainingP, Incumbent &incumbent,
+                       AnytimePoller &poller) {
+    const size_t n = perm.size();
+    if (poller.shouldStop()) {
+        return;
+    }
+    if (depth == n) {
+        incumbent.offer(currentCmax, perm);
+        return;
+    }
+
+    for (size_t i = depth; i < n; i++) {
+        std::swap(perm[depth], perm[i]);
+
+        const int j = perm[depth];
+        int time = std::max(currentTime, instance.r()[j]) + instance.p()[j];
+        int Cmax = std::max(currentCmax, time + instance.q()[j]);
+        const long rest = remainingP - instance.p()[j];
+        if (prefixBound(time, Cmax, rest) < incumbent.load()) {
+            enumerateSuffixes(instance, perm, depth + 1, time, Cmax, rest, incumbent, poller);
+        }
+
+        std::swap(perm[depth], perm[i]);
+    }
+}
+
+/**
+ * @brief Generuje prefiksy długości prefixLength i zleca puli przegląd ich poddrzew.
+ *
+ * Prefiksy (także krótsze), których dolne ograniczenie nie jest mniejsze od najlepszego wyniku,
+ * nie trafiają do puli.
+ */
+void submitPrefixes(const Instance &instance, std::vector<int> &perm, size_t depth, size_t prefixLength,
+                    int currentTime, int currentCmax, long remainingP, Incumbent &incumbent,
+                    const AnytimeControl &control, ThreadPool &pool) {
+    if (prefixBound(currentTime, currentCmax, remainingP) >= incumbent.load()) {
+        return;
+    }
+    if (depth == prefixLength) {
+        pool.submit([&instance, &incumbent, &control, perm, depth, currentTime, currentCmax, remainingP]() mutable {
+            // Wynik mógł się poprawić, zanim zadanie trafiło do wątku
+            AnytimePoller poller(control);
+            if (prefixBound(currentTime, currentCmax, remainingP) < incumbent.load()) {
+                enumerateSuffixes(instance, perm, depth, currentTime, currentCmax, remainingP, incumbent, poller);
+            }
+        });
+        return;
+    }
+
+    for (size_t i = depth; i < perm.size(); i++) {
+        std::swap(perm[depth], perm[i]);
+        const int j = perm[depth];
+        int time = std::max(currentTime, instance.r()[j]) + instance.p()[j];
+        submitPrefixes(instance, perm, depth + 1, prefixLength, time, std::max(currentCmax, time + instance.q()[j]),
+                       remainingP - instance.p()[j], incumbent, control, pool);
+        std::swap(perm[depth], perm[i]);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Równoległy przegląd zupełny ze współdzieleniem prefiksów.
+ *
+ * Przestrzeń permutacji dzielona jest według ustalonych prefiksów między wątki puli. W obrębie poddrzewa
+ * częściowe currentTime/currentCmax prefiksu są używane ponownie, więc liść kosztuje zamortyzowane O(1)
+ * zamiast O(n). Prefiksy z dolnym ograniczeniem nie mniejszym od najlepszego wyniku są odcinane - już
+ * przed przekazaniem do puli.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor wyjściowy - optymalna kolejność wykonania jako indeksy zadań.
+ * @param threadCount Liczba wątków (0 oznacza liczbę rdzeni).
+ * @return Minimalny czas zakończenia wszystkich zadań (Cmax).
+ */
+int bruteForceParallel(const Instance &instance, std::vector<int> &order, int threadCount) {
+    return bruteForceParallel(instance, order, threadCount, AnytimeControl());
+}
+
+/**
+ * @brief Równoległy przegląd zupełny z możliwością przerwania.
+ *
+ * Rozwiązaniem początkowym jest permutacja Schrage, więc odcinanie działa od pierwszego poddrzewa,
+ * a przerwany przegląd zawsze zwraca poprawną permutację. Poprawy zgłaszane są przez control.improved (pod blokadą Incumbent), a każde
+ * zadanie puli sprawdza przerwanie co 1024 węzły.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor wyjściowy - najlepsza znaleziona kolejność jako indeksy zadań.
+ * @param threadCount Liczba wątków (0 oznacza liczbę rdzeni).
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszej znalezionej permutacji (optymalny, jeśli przegląd nie został przerwany).
+ */
+int bruteForceParallel(const Instance &instance, std::vector<int> &order, int threadCount,
+                       const AnytimeControl &control) {
+    const size_t n = instance.size();
+    if (n == 0) {
+        order.clear();
+        return 0;
+    }
+
+    ThreadPool pool(threadCount);
+    Incumbent incumbent(&control);
+
+    // Długość prefiksu dobieramy tak, by zadań było kilka razy więcej niż wątków
+    size_t prefixLength = 0;
+    size_t prefixCount = 1;
+    while (prefixLength < n && prefixCount < 8 * static_cast<size_t>(pool.size())) {
+        prefixCount *= n - prefixLength;
+        prefixLength++;
+    }
+
+    // Ograniczenie górne z algorytmu Schrage, zanim wątki zaczną przeglądać poddrzewa
+    ScratchArena arena;
+    std::vector<int> perm;
+    incumbent.offer(schragePlaning(instance, arena, perm), perm);
+
+    long sumP = 0;
+    for (size_t i = 0; i < n; i++) {
+        perm[i] = static_cast<int>(i);
+        sumP += instance.p()[i];
+    }
+    submitPrefixes(instance, perm, 0, prefixLength, 0, 0, sumP, incumbent, control, pool);
+    pool.wait();
 
-    return Cmax;
-}
\ No newline at end of file
+    return incumbent.best(order);
+}
@@ -1,7 +1,7 @@
 #include "alg_03_wspt.h"
 #include <algorithm>
 #include <vector>
-#include "task_struct.h"
+#include "cmax_eval.h"
 
 /**
  * @brief Algorytm Ważonego Najkrótszego Czasu Przetwarzania (WSPT)
@@ -10,38 +10,46 @@
  * jak i czas dostarczenia do ustalenia priorytetów zadań. Oblicza wartość priorytetu
  * na podstawie ważonej kombinacji p i q.
  *
- * @param tasks Wektor zadań do zaplanowania
+ * @param instance Instancja problemu
+ * @param arena Pamięć robocza algorytmu
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań
  * @return Maksymalny czas zakończenia (Cmax)
  */
-int weightedSPTPlaning(std::vector<task> tasks) {
-    if (tasks.empty()) {
+int weightedSPTPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    return weightedSPTPlaning(instance, arena, order, WsptWeights());
+}
+
+/**
+ * @brief WSPT z podanymi współczynnikami priorytetu (np. dobranymi przez tuneWsptWeights).
+ *
+ * @param instance Instancja problemu
+ * @param arena Pamięć robocza algorytmu
+ * @param order Wektor wyjściowy - kolejność wykonania jako indeksy zadań
+ * @param weights Wagi q i r w priorytecie p - q * q_j + r * r_j
+ * @return Maksymalny czas zakończenia (Cmax)
+ */
+int weightedSPTPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                       const WsptWeights &weights) {
+    const int n = instance.size();
+    order.resize(n);
+    if (n == 0) {
         return 0;
     }
+    ScratchArena::Scope scope(arena);
+
+    // Niższa wartość = wyższy priorytet
+    // Przy domyślnych wagach formuła priorytetyzuje zadania z niskim p i wysokim q
+    double *priority = arena.allocate<double>(n);
+    for (int i = 0; i < n; i++) {
+        priority[i] = wsptPriority(instance.p()[i], instance.q()[i], instance.r()[i], weights);
+        order[i] = i;
+    }
 
     // Sortowanie zadań według wzoru ważonego priorytetu
-    std::sort(tasks.begin(), tasks.end(), [](const task& a, const task& b) {
-        // Niższa wartość = wyższy priorytet
-        // Ta formuła priorytetyzuje zadania z niskim p i wysokim q
-        return (a.p - 0.5 * a.q) < (b.p - 0.5 * b.q);
+    std::sort(order.begin(), order.end(), [priority](int a, int b) {
+        return priority[a] < priority[b] || (priority[a] == priority[b] && a < b);
     });
 
-    int currentTime = 0;
-    int Cmax = 0;
-
     // Planowanie zadań zgodnie z priorytetem
-    for (const auto& t : tasks) {
-        // Jeśli zadanie nie jest jeszcze dostępne, czekamy
-        if (currentTime < t.r) {
-            currentTime = t.r;
-        }
-
-        // Wykonanie zadania
-        currentTime += t.p;
-
-        // Obliczenie czasu zakończenia i aktualizacja Cmax
-        int completionTime = currentTime + t.q;
-        Cmax = std::max(Cmax, completionTime);
-    }
-
-    return Cmax;
-}
\ No newline at end of file
+    return evaluateCmax(instance, order.data());
+}
@@ -0,0 +1,130 @@
+#include "alg_04_carlier.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "cmax_eval.h"
+#include "critical_path.h"
+#include "lower_bound.h"
+
+namespace {
+
+/**
+ * @brief Stan przeszukiwania algorytmu Carliera współdzielony przez wszystkie węzły drzewa.
+ */
+struct CarlierState {
+    const Instance &original; ///< Dane wejściowe (do oceny permutacji)
+    ScratchArena &arena;      ///< Pamięć robocza (permutacje węzłów, Schrage)
+    int *r;                   ///< Czasy dostępności modyfikowane w kolejnych węzłach
+    int *q;                   ///< Czasy dostarczenia modyfikowane w kolejnych węzłach
+    Instance work;            ///< Widok na dane węzła (r, oryginalne p, q)
+    std::vector<int> &best;   ///< Najlepsza znaleziona permutacja
+    int UB;                   ///< Górne ograniczenie - najlepszy znaleziony Cmax
+    const AnytimeControl &control; ///< Przerwanie i powiadomienia o poprawie
+};
+
+/**
+ * @brief Jeden węzeł drzewa podziału i ograniczeń algorytmu Carliera.
+ *
+ * Schrage wyznacza rozwiązanie i górne ograniczenie. Na ścieżce krytycznej szukamy zadania b
+ * (ostatnie z Cmax), początku bloku a oraz zadania interferencyjnego c (ostatnie w bloku z q < q_b).
+ * Potem rozgałęziamy: c przed blokiem K = (c, b] (podnosimy r_c) albo c za blokiem (podnosimy q_c).
+ * Gałąź odcinamy, jeśli dolne ograniczenie (Schrage z wywłaszczaniem, h(K), h(K + c)) nie jest mniejsze od UB.
+ * Po przerwaniu nowe węzły nie są rozwijane (korzeń zawsze, żeby istniało rozwiązanie).
+ */
+void carlierNode(CarlierState &s) {
+    if (s.UB != INT_MAX && s.control.stopRequested()) {
+        return;
+    }
+
+    ScratchArena::Scope scope(s.arena);
+    const int n = s.original.size();
+    int *order = s.arena.allocate<int>(n);
+    schragePlaning(s.work, s.arena, order);
+
+    // Permutację oceniamy na oryginalnych danych - zmodyfikowane r/q mogą tylko zawyżać Cmax
+    int realCmax = evaluateCmax(s.original, order);
+    if (realCmax < s.UB) {
+        s.UB = realCmax;
+        s.best.assign(order, order + n);
+        s.control.improved(s.UB, s.best);
+    }
+
+    const CriticalPath path = analyzeSchedule(s.work, order);
+
+    // Brak zadania interferencyjnego - rozwiązanie Schrage jest optymalne w tym węźle
+    if (path.c == -1) {
+        return;
+    }
+
+    const int rK = path.rK, pK = path.pK, qK = path.qK;
+    const int c = order[path.c];
+    const int blockLB = criticalBlockBound(s.work, order, path);
+
+    // Gałąź 1: zadanie c wykonywane po wszystkich zadaniach bloku K
+    const int savedR = s.r[c];
+    s.r[c] = std::max(s.r[c], rK + pK);
+    int LB = std::max(schragePreemptivePlaning(s.work, s.arena), blockLB);
+    if (LB < s.UB) {
+        carlierNode(s);
+    }
+    s.r[c] = savedR;
+
+    // Gałąź 2: zadanie c wykonywane przed wszystkimi zadaniami bloku K
+    const int savedQ = s.q[c];
+    s.q[c] = std::max(s.q[c], qK + pK);
+    LB = std::max(schragePreemptivePlaning(s.work, s.arena), blockLB);
+    if (LB < s.UB) {
+        carlierNode(s);
+    }
+    s.q[c] = savedQ;
+}
+
+} // namespace
+
+/**
+ * @brief Algorytm Carliera (podział i ograniczenia) dla problemu 1|r_j,q_j|Cmax.
+ *
+ * Górnym ograniczeniem jest algorytm Schrage, dolnym - Schrage z wywłaszczaniem.
+ * Zmodyfikowane kolumny r/q oraz permutacje kolejnych węzłów pochodzą z areny.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - optymalna kolejność wykonania jako indeksy zadań.
+ * @return Optymalny maksymalny czas zakończenia (Cmax).
+ */
+int carlierPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    return carlierPlaning(instance, arena, order, AnytimeControl());
+}
+
+/**
+ * @brief Algorytm Carliera z możliwością przerwania.
+ *
+ * Przerwanie sprawdzane jest przed rozwinięciem każdego węzła; każde lepsze rozwiązanie trafia
+ * do control.improved.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - najlepsza znaleziona kolejność jako indeksy zadań.
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszego rozwiązania (optymalny, jeśli przeszukiwanie nie zostało przerwane).
+ */
+int carlierPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                   const AnytimeControl &control) {
+    const int n = instance.size();
+    if (n == 0) {
+        order.clear();
+        return 0;
+    }
+
+    ScratchArena::Scope scope(arena);
+    int *r = arena.allocate<int>(n);
+    int *q = arena.allocate<int>(n);
+    std::copy(instance.r(), instance.r() + n, r);
+    std::copy(instance.q(), instance.q() + n, q);
+
+    CarlierState state{instance, arena, r, q, Instance::borrow(n, r, instance.p(), q), order, INT_MAX, control};
+    carlierNode(state);
+
+    return state.UB;
+}
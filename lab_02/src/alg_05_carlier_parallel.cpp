@@ -0,0 +1,202 @@
+#include "alg_05_carlier_parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "alg_04_carlier.h"
+#include "cmax_eval.h"
+#include "critical_path.h"
+#include "incumbent.h"
+#include "lower_bound.h"
+
+namespace {
+
+/**
+ * @brief Podproblem drzewa Carliera - zmodyfikowane wektory r i q wraz z dolnym ograniczeniem.
+ */
+struct CarlierNode {
+    std::vector<int> r; ///< Czasy dostępności w tym węźle
+    std::vector<int> q; ///< Czasy dostarczenia w tym węźle
+    int LB;             ///< Dolne ograniczenie policzone przy tworzeniu węzła
+};
+
+/**
+ * @brief Kolejka zadań jednego wątku. Właściciel pracuje na końcu (przeszukiwanie w głąb),
+ * pozostałe wątki kradną z początku, gdzie leżą najpłytsze (największe) poddrzewa.
+ */
+struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<CarlierNode> nodes;
+};
+
+/**
+ * @brief Stan współdzielony przez wszystkie wątki przeszukiwania.
+ */
+struct SharedSearch {
+    const Instance &original;            ///< Dane wejściowe
+    std::vector<WorkerQueue> queues;     ///< Kolejki poszczególnych wątków
+    Incumbent UB;                        ///< Najlepsze znane rozwiązanie (Cmax czytany bez blokad)
+    std::atomic<long> pending{0};        ///< Liczba węzłów jeszcze nieprzetworzonych
+    const AnytimeControl &control;       ///< Przerwanie i powiadomienia o poprawie
+
+    SharedSearch(const Instance &instance, int threadCount, const AnytimeControl &control)
+            : original(instance), queues(threadCount), UB(&control), control(control) {}
+};
+
+void pushNode(SharedSearch &shared, int worker, CarlierNode &&node) {
+    shared.pending.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(shared.queues[worker].mutex);
+    shared.queues[worker].nodes.push_back(std::move(node));
+}
+
+bool popNode(SharedSearch &shared, int worker, CarlierNode &node) {
+    WorkerQueue &queue = shared.queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.nodes.empty()) {
+        return false;
+    }
+    node = std::move(queue.nodes.back());
+    queue.nodes.pop_back();
+    return true;
+}
+
+bool stealNode(SharedSearch &shared, int worker, std::mt19937 &gen, CarlierNode &node) {
+    const int threadCount = static_cast<int>(shared.queues.size());
+    int start = static_cast<int>(gen() % threadCount);
+    for (int k = 0; k < threadCount; k++) {
+        int victim = (start + k) % threadCount;
+        if (victim == worker) {
+            continue;
+        }
+        WorkerQueue &queue = shared.queues[victim];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.nodes.empty()) {
+            node = std::move(queue.nodes.front());
+            queue.nodes.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Przetwarza jeden węzeł: Schrage, ocena permutacji, wyznaczenie bloku i utworzenie potomków.
+ * Kolumny r/q węzła są modyfikowane na czas liczenia ograniczeń potomków i przywracane.
+ */
+void expandNode(SharedSearch &shared, int worker, CarlierNode &node, ScratchArena &arena, std::vector<int> &order) {
+    const Instance &original = shared.original;
+    const Instance work = Instance::borrow(original.size(), node.r.data(), original.p(), node.q.data());
+
+    schragePlaning(work, arena, order);
+    shared.UB.offer(evaluateCmax(original, order.data()), order);
+
+    const CriticalPath path = analyzeSchedule(work, order.data());
+    if (path.c == -1) {
+        return;
+    }
+
+    const int c = order[path.c];
+    const int blockLB = criticalBlockBound(work, order.data(), path);
+
+    // Gałąź 1: c po bloku K (podnosimy r_c), gałąź 2: c przed blokiem K (podnosimy q_c)
+    for (int branch = 0; branch < 2; branch++) {
+        int &field = branch == 0 ? node.r[c] : node.q[c];
+        const int saved = field;
+        field = std::max(field, (branch == 0 ? path.rK : path.qK) + path.pK);
+
+        int LB = std::max(schragePreemptivePlaning(work, arena), blockLB);
+        if (LB < shared.UB.load()) {
+            pushNode(shared, worker, CarlierNode{node.r, node.q, LB});
+        }
+        field = saved;
+    }
+}
+
+void workerLoop(SharedSearch &shared, int worker) {
+    ScratchArena arena;
+    std::vector<int> order;
+    std::mt19937 gen(worker + 1);
+    CarlierNode node;
+
+    // Po przerwaniu wątki kończą pracę bez opróżniania kolejek; korzeń jest zawsze rozwijany
+    while (shared.UB.load() == INT_MAX || !shared.control.stopRequested()) {
+        if (!popNode(shared, worker, node) && !stealNode(shared, worker, gen, node)) {
+            if (shared.pending.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Węzeł mógł się zdezaktualizować, gdy inny wątek poprawił UB
+        if (node.LB < shared.UB.load()) {
+            expandNode(shared, worker, node, arena, order);
+        }
+        shared.pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Wielowątkowy algorytm Carliera dla problemu 1|r_j,q_j|Cmax.
+ *
+ * Węzły drzewa (zmodyfikowane wektory r/q) trafiają do kolejek poszczególnych wątków; wątek bez pracy
+ * kradnie węzły z kolejek innych. Najlepszy Cmax jest współdzielony przez zmienną atomową, dzięki czemu
+ * każdy wątek odcina gałęzie na podstawie rozwiązań znalezionych przez pozostałe.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor wyjściowy - optymalna kolejność wykonania jako indeksy zadań.
+ * @param threadCount Liczba wątków roboczych (0 oznacza liczbę rdzeni).
+ * @return Optymalny maksymalny czas zakończenia (Cmax).
+ */
+int carlierParallelPlaning(const Instance &instance, std::vector<int> &order, int threadCount) {
+    return carlierParallelPlaning(instance, order, threadCount, AnytimeControl());
+}
+
+/**
+ * @brief Wielowątkowy algorytm Carliera z możliwością przerwania.
+ *
+ * Każdy wątek sprawdza przerwanie przed pobraniem kolejnego węzła; poprawy zgłaszane są przez
+ * control.improved pod blokadą Incumbent.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor wyjściowy - najlepsza znaleziona kolejność jako indeksy zadań.
+ * @param threadCount Liczba wątków roboczych (0 oznacza liczbę rdzeni).
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszego rozwiązania (optymalny, jeśli przeszukiwanie nie zostało przerwane).
+ */
+int carlierParallelPlaning(const Instance &instance, std::vector<int> &order, int threadCount,
+                           const AnytimeControl &control) {
+    const int n = instance.size();
+    if (n == 0) {
+        order.clear();
+        return 0;
+    }
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+
+    SharedSearch shared(instance, threadCount, control);
+
+    ScratchArena arena;
+    CarlierNode root{std::vector<int>(instance.r(), instance.r() + n),
+                     std::vector<int>(instance.q(), instance.q() + n),
+                     schragePreemptivePlaning(instance, arena)};
+    pushNode(shared, 0, std::move(root));
+
+    std::vector<std::thread> workers;
+    for (int w = 1; w < threadCount; w++) {
+        workers.emplace_back(workerLoop, std::ref(shared), w);
+    }
+    workerLoop(shared, 0);
+    for (auto &worker: workers) {
+        worker.join();
+    }
+
+    return shared.UB.best(order);
+}
@@ -0,0 +1,125 @@
+#include "alg_06_bitmask_dp.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+#include "alg_01_schrage.h"
+
+namespace {
+
+constexpr int32_t UNREACHABLE = INT32_MAX;
+
+/**
+ * @brief Sprawdza, czy istnieje permutacja o Cmax <= T (każde zadanie ma termin d_j = T - q_j).
+ *
+ * f[S] to najwcześniejszy moment zakończenia zbioru S ułożonego na początku harmonogramu tak,
+ * by wszystkie zadania z S zdążyły przed terminem. Wcześniejsze zakończenie dominuje późniejsze,
+ * więc jedna liczba na podzbiór wystarcza. Stan, po którym któreś z pozostałych zadań nie może
+ * już zdążyć, jest martwy i nie jest rozwijany.
+ *
+ * @param instance Instancja problemu.
+ * @param T Badana wartość Cmax.
+ * @param f Tablica stanów o rozmiarze 2^n (nadpisywana).
+ * @return true, jeśli wszystkie zadania da się wykonać z Cmax <= T.
+ */
+bool feasible(const Instance &instance, int T, int32_t *f) {
+    const int n = instance.size();
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    const uint32_t full = (1u << n) - 1;
+
+    std::fill(f, f + full + 1, UNREACHABLE);
+    f[0] = 0;
+
+    for (uint32_t S = 0; S < full; S++) {
+        if (f[S] == UNREACHABLE) {
+            continue;
+        }
+
+        // Odcięcie: jeśli któreś z pozostałych zadań nie zdąży nawet jako następne, stan jest martwy
+        bool alive = true;
+        for (int j = 0; j < n && alive; j++) {
+            if (!(S & (1u << j))) {
+                alive = std::max(f[S], r[j]) + p[j] + q[j] <= T;
+            }
+        }
+        if (!alive) {
+            continue;
+        }
+
+        for (int j = 0; j < n; j++) {
+            if (!(S & (1u << j))) {
+                int32_t completion = std::max(f[S], r[j]) + p[j];
+                f[S | (1u << j)] = std::min(f[S | (1u << j)], completion);
+            }
+        }
+    }
+
+    return f[full] != UNREACHABLE;
+}
+
+} // namespace
+
+/**
+ * @brief Dokładny algorytm dla 1|r_j,q_j|Cmax oparty na programowaniu dynamicznym po podzbiorach.
+ *
+ * Wartość Cmax jest wyszukiwana binarnie między dolnym ograniczeniem (Schrage z wywłaszczeniem)
+ * a górnym (Schrage). Dla każdej badanej wartości T sprawdzana jest wykonalność w czasie O(2^n * n)
+ * na zwartej tablicy int32 z areny. Permutacja jest odtwarzana z tablicy stanów dla optymalnego T.
+ *
+ * @param instance Instancja problemu (co najwyżej BITMASK_DP_MAX_TASKS zadań).
+ * @param arena Pamięć robocza algorytmu.
+ * @param order Wektor wyjściowy - optymalna kolejność wykonania jako indeksy zadań.
+ * @return Optymalny maksymalny czas zakończenia (Cmax) albo -1, jeśli zadań jest za dużo (pominięcie
+ * zgłasza wywołujący - main i tryb wsadowy sprawdzają limit z algorithm_registry przed wywołaniem).
+ */
+int bitmaskDPPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order) {
+    const int n = instance.size();
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+
+    if (n > BITMASK_DP_MAX_TASKS) {
+        order.clear();
+        return -1;
+    }
+    order.resize(n);
+    if (n == 0) {
+        return 0;
+    }
+
+    ScratchArena::Scope scope(arena);
+    int32_t *f = arena.allocate<int32_t>(static_cast<size_t>(1) << n);
+
+    // Wyszukiwanie binarne najmniejszego wykonalnego T w przedziale [LB, UB]
+    int low = schragePreemptivePlaning(instance, arena);
+    int high = schragePlaning(instance, arena, nullptr);
+    while (low < high) {
+        int mid = low + (high - low) / 2;
+        if (feasible(instance, mid, f)) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+
+    // Odtworzenie permutacji dla optymalnego Cmax
+    feasible(instance, high, f);
+    uint32_t S = (1u << n) - 1;
+    for (int position = n - 1; position >= 0; position--) {
+        for (int j = 0; j < n; j++) {
+            if (!(S & (1u << j))) {
+                continue;
+            }
+            uint32_t previous = S & ~(1u << j);
+            if (f[previous] == UNREACHABLE) {
+                continue;
+            }
+            int32_t completion = std::max(f[previous], r[j]) + p[j];
+            if (completion == f[S] && completion + q[j] <= high) {
+                order[position] = j;
+                S = previous;
+                break;
+            }
+        }
+    }
+
+    return high;
+}
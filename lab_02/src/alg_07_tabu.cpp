@@ -0,0 +1,208 @@
+#include "alg_07_tabu.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+#include "alg_01_schrage.h"
+#include "critical_path.h"
+#include "schedule_segment.h"
+
+namespace {
+
+/**
+ * @brief Bieżące rozwiązanie przeszukiwania z tabu wraz z zapamiętanymi głowami i ogonami.
+ */
+struct TabuState {
+    const int *r, *p, *q;
+    int n;
+    int *perm;      ///< Bieżąca permutacja
+    int *C;         ///< C[k] - moment zakończenia zadania na pozycji k
+    int *PM;        ///< PM[k] - największe C_j + q_j dla pozycji 0..k
+    Segment *tail;  ///< tail[k] - fragment od pozycji k do końca (tail[n] jest pusty)
+
+    Segment jobAt(int k) const {
+        const int j = perm[k];
+        return Segment::job(r[j], p[j], q[j]);
+    }
+
+    /**
+     * @brief Cmax permutacji złożonej z pozycji 0..start-1, fragmentu middle i pozycji resume..n-1
+     */
+    int evaluate(int start, const Segment &middle, int resume) const {
+        const int t = start > 0 ? C[start - 1] : 0;
+        const int head = start > 0 ? PM[start - 1] : SEGMENT_NEG;
+        return std::max({head, middle.value(t), tail[resume].value(middle.end(t))});
+    }
+
+    /**
+     * @brief Przelicza głowy od pozycji lo w górę i ogony od pozycji hi w dół
+     */
+    void update(int lo, int hi) {
+        for (int k = lo; k < n; k++) {
+            const int j = perm[k];
+            C[k] = std::max(k > 0 ? C[k - 1] : 0, r[j]) + p[j];
+            PM[k] = std::max(k > 0 ? PM[k - 1] : SEGMENT_NEG, C[k] + q[j]);
+        }
+        for (int k = hi; k >= 0; k--) {
+            tail[k] = jobAt(k).then(tail[k + 1]);
+        }
+    }
+};
+
+/**
+ * @brief Rodzaj ruchu w sąsiedztwie bloku krytycznego.
+ */
+enum class MoveType {
+    ToFront, ///< Zadanie z pozycji i wstawione na początek bloku (pozycja a)
+    ToBack,  ///< Zadanie z pozycji i wstawione na koniec bloku (pozycja b)
+    Swap     ///< Zamiana zadań na pozycjach i oraz i + 1
+};
+
+struct Move {
+    MoveType type;
+    int i;
+    int Cmax;
+};
+
+} // namespace
+
+/**
+ * @brief Przeszukiwanie z tabu dla problemu 1|r_j,q_j|Cmax startujące z permutacji Schrage.
+ *
+ * Sąsiedztwo (w duchu Nowickiego-Smutnickiego) obejmuje tylko blok krytyczny a..b: przeniesienie
+ * zadania bloku na jego początek lub koniec oraz zamiany sąsiednich zadań w bloku. Ruch poza
+ * ścieżką krytyczną nie może zmniejszyć Cmax. Każdy ruch oceniany jest w O(1) z zapamiętanych głów
+ * (C, prefiksowe maksimum C + q) i ogonów (złożone fragmenty od pozycji do końca); fragment
+ * przesuwany przez ruch jest składany przyrostowo. Zakazane jest ponowne przesunięcie zadania przez
+ * options.tenure iteracji, chyba że ruch poprawia najlepsze rozwiązanie (kryterium aspiracji).
+ * Przeszukiwanie kończy się po options.maxIterations iteracjach, po options.maxStagnation iteracjach
+ * bez poprawy albo po osiągnięciu dolnego ograniczenia (Schrage z wywłaszczaniem).
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry przeszukiwania.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int tabuSearchPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                      const TabuOptions &options) {
+    return tabuSearchPlaning(instance, arena, order, options, AnytimeControl());
+}
+
+/**
+ * @brief Przeszukiwanie z tabu z możliwością przerwania.
+ *
+ * Przerwanie sprawdzane jest co iterację; rozwiązanie startowe i każde kolejne lepsze trafiają
+ * do control.improved.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry przeszukiwania.
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int tabuSearchPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                      const TabuOptions &options, const AnytimeControl &control) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+    order.clear();
+    if (n == 0) {
+        return 0;
+    }
+
+    TabuState s{instance.r(), instance.p(), instance.q(), n,
+                arena.allocate<int>(n), arena.allocate<int>(n), arena.allocate<int>(n),
+                arena.allocate<Segment>(n + 1)};
+    int *tabuUntil = arena.allocate<int>(n);
+    std::fill(tabuUntil, tabuUntil + n, 0);
+
+    schragePlaning(instance, arena, s.perm);
+    s.tail[n] = Segment::empty();
+    s.update(0, n - 1);
+
+    const int LB = schragePreemptivePlaning(instance, arena);
+    int bestCmax = s.PM[n - 1];
+    order.assign(s.perm, s.perm + n);
+    control.improved(bestCmax, order);
+
+    int stagnation = 0;
+    for (int iteration = 1; iteration <= options.maxIterations && stagnation < options.maxStagnation
+                            && bestCmax > LB; iteration++) {
+        if (control.stopRequested()) {
+            break;
+        }
+
+        const int Cmax = s.PM[n - 1];
+
+        // Blok krytyczny z utrzymywanych przyrostowo momentów zakończenia
+        const CriticalPath path = criticalBlock(instance, s.perm, s.C, Cmax);
+        const int a = path.a, b = path.b;
+        if (a == b) {
+            break; // Cmax = r + p + q jednego zadania - rozwiązanie optymalne
+        }
+
+        Move bestAllowed{MoveType::Swap, -1, INT_MAX}, bestAny{MoveType::Swap, -1, INT_MAX};
+        auto consider = [&](MoveType type, int i, int value, bool forbidden) {
+            if (value < bestAny.Cmax) {
+                bestAny = {type, i, value};
+            }
+            if ((!forbidden || value < bestCmax) && value < bestAllowed.Cmax) {
+                bestAllowed = {type, i, value};
+            }
+        };
+
+        // Przeniesienie na początek bloku: shifted to fragment a..i-1 przesuwany o jedną pozycję w prawo
+        Segment shifted = Segment::empty();
+        for (int i = a + 1; i <= b; i++) {
+            shifted = shifted.then(s.jobAt(i - 1));
+            consider(MoveType::ToFront, i, s.evaluate(a, s.jobAt(i).then(shifted), i + 1),
+                     tabuUntil[s.perm[i]] >= iteration);
+        }
+
+        // Przeniesienie na koniec bloku: shifted to fragment i+1..b przesuwany o jedną pozycję w lewo
+        shifted = Segment::empty();
+        for (int i = b - 1; i >= a; i--) {
+            shifted = s.jobAt(i + 1).then(shifted);
+            consider(MoveType::ToBack, i, s.evaluate(i, shifted.then(s.jobAt(i)), b + 1),
+                     tabuUntil[s.perm[i]] >= iteration);
+        }
+
+        // Zamiany sąsiednich zadań wewnątrz bloku
+        for (int i = a + 1; i + 2 <= b; i++) {
+            consider(MoveType::Swap, i, s.evaluate(i, s.jobAt(i + 1).then(s.jobAt(i)), i + 2),
+                     tabuUntil[s.perm[i]] >= iteration || tabuUntil[s.perm[i + 1]] >= iteration);
+        }
+
+        // Wszystkie ruchy zakazane - wykonujemy najlepszy mimo zakazu, żeby nie utknąć
+        const Move move = bestAllowed.i != -1 ? bestAllowed : bestAny;
+        const int i = move.i;
+        switch (move.type) {
+            case MoveType::ToFront:
+                tabuUntil[s.perm[i]] = iteration + options.tenure;
+                std::rotate(s.perm + a, s.perm + i, s.perm + i + 1);
+                s.update(a, i);
+                break;
+            case MoveType::ToBack:
+                tabuUntil[s.perm[i]] = iteration + options.tenure;
+                std::rotate(s.perm + i, s.perm + i + 1, s.perm + b + 1);
+                s.update(i, b);
+                break;
+            case MoveType::Swap:
+                tabuUntil[s.perm[i]] = tabuUntil[s.perm[i + 1]] = iteration + options.tenure;
+                std::swap(s.perm[i], s.perm[i + 1]);
+                s.update(i, i + 1);
+                break;
+        }
+
+        if (s.PM[n - 1] < bestCmax) {
+            bestCmax = s.PM[n - 1];
+            order.assign(s.perm, s.perm + n);
+            control.improved(bestCmax, order);
+            stagnation = 0;
+        } else {
+            stagnation++;
+        }
+    }
+
+    return bestCmax;
+}
@@ -0,0 +1,201 @@
+#include "alg_08_portfolio.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "alg_00_heuristic.h"
+#include "alg_01_schrage.h"
+#include "alg_03_wspt.h"
+#include "incumbent.h"
+#include "scratch_arena.h"
+#include "thread_pool.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Algorytm portfolio; control pozwala przerwać przeszukiwanie lokalne i przekazuje jego poprawy.
+ */
+struct PortfolioMember {
+    const char *name;
+    int (*run)(const Instance &, ScratchArena &, std::vector<int> &, const PortfolioOptions &,
+               const AnytimeControl &);
+};
+
+/**
+ * @brief Skład portfolio: najpierw szybkie heurystyki konstrukcyjne, na końcu przeszukiwanie lokalne.
+ */
+const PortfolioMember MEMBERS[] = {
+        {"rj_sort", [](const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                       const PortfolioOptions &, const AnytimeControl &) {
+            return rjSortPlaning(instance, arena, order);
+        }},
+        {"qj_sort", [](const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                       const PortfolioOptions &, const AnytimeControl &) {
+            return qjSortPlaning(instance, arena, order);
+        }},
+        {"schrage", [](const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                       const PortfolioOptions &, const AnytimeControl &) {
+            return schragePlaning(instance, arena, order);
+        }},
+        {"wspt", [](const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                    const PortfolioOptions &, const AnytimeControl &) {
+            return weightedSPTPlaning(instance, arena, order);
+        }},
+        {"tabu", [](const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                    const PortfolioOptions &options, const AnytimeControl &control) {
+            return tabuSearchPlaning(instance, arena, order, options.tabu, control);
+        }},
+};
+
+constexpr int MEMBER_COUNT = static_cast<int>(sizeof(MEMBERS) / sizeof(MEMBERS[0]));
+
+/**
+ * @brief Stan współdzielony przez przebiegi portfolio.
+ */
+struct PortfolioShared {
+    Incumbent incumbent;                 ///< Najlepsze rozwiązanie (Cmax czytany bez blokad)
+    Clock::time_point start;             ///< Start portfolio
+    std::atomic<bool> stop{false};       ///< Ustawiane po osiągnięciu dolnego ograniczenia lub limitu czasu
+    std::mutex mutex;                    ///< Chroni pola poniżej
+    std::condition_variable finished;    ///< Budzi wątek wywołujący po zakończeniu przebiegu
+    int remaining = MEMBER_COUNT;        ///< Liczba przebiegów, które jeszcze się nie zakończyły
+    const char *bestAlgorithm = nullptr; ///< Pochodzenie rozwiązania w incumbent
+    double secondsToBest = 0;            ///< Czas znalezienia rozwiązania w incumbent
+    bool truncated = false;              ///< Czy któryś przebieg zakończyło przerwanie (limit, termin, flaga)
+
+    PortfolioShared(const AnytimeControl &control, Clock::time_point start) : incumbent(&control), start(start) {}
+
+    /**
+     * @brief Zgłasza rozwiązanie algorytmu member; wywoływane pod mutex.
+     */
+    void offer(int member, int Cmax, const std::vector<int> &order) {
+        if (incumbent.offer(Cmax, order)) {
+            bestAlgorithm = MEMBERS[member].name;
+            secondsToBest = std::chrono::duration<double>(Clock::now() - start).count();
+        }
+    }
+};
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+/**
+ * @brief Portfolio: heurystyki rj-sort, qj-sort, Schrage, WSPT i przeszukiwanie z tabu uruchamiane równolegle.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry portfolio.
+ * @return Najlepszy Cmax z nazwą algorytmu, który go znalazł, czasami i wynikami wszystkich przebiegów.
+ */
+PortfolioResult portfolioPlaning(const Instance &instance, std::vector<int> &order, const PortfolioOptions &options) {
+    return portfolioPlaning(instance, order, options, AnytimeControl());
+}
+
+/**
+ * @brief Portfolio z zewnętrznym sterowaniem (flaga przerwania, termin, powiadomienia o poprawie).
+ *
+ * Przebiegi działają w puli wątków i zgłaszają wyniki do wspólnego najlepszego rozwiązania (Incumbent);
+ * przeszukiwanie z tabu zgłasza także każdą poprawę w trakcie działania. Wszystkie kończą się razem,
+ * gdy któryś osiągnie dolne ograniczenie (Schrage z wywłaszczaniem - wynik jest wtedy optymalny),
+ * upłynie options.timeBudgetSeconds lub termin z control albo zostanie ustawiona flaga przerwania
+ * z control: przeszukiwanie lokalne reaguje w kolejnej iteracji, a przebiegi jeszcze nierozpoczęte
+ * są pomijane. Heurystyki konstrukcyjne działają w czasie O(n log n), więc nie są przerywane.
+ * Każda poprawa wspólnego rozwiązania trafia do control.improved. Wynik nieoptymalny skrócony przez
+ * którykolwiek z tych powodów (także przez własny options.timeBudgetSeconds) ma interrupted == true
+ * i jest zgłaszany przez control.interrupted(), tak jak w algorytmach przerwanych terminem z control.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry portfolio.
+ * @param control Zewnętrzna flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Najlepszy Cmax z nazwą algorytmu, który go znalazł, czasami i wynikami wszystkich przebiegów.
+ */
+PortfolioResult portfolioPlaning(const Instance &instance, std::vector<int> &order, const PortfolioOptions &options,
+                                 const AnytimeControl &control) {
+    const Clock::time_point start = Clock::now();
+    const auto deadline = std::min(control.deadline, start + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(options.timeBudgetSeconds)));
+
+    PortfolioResult result;
+    result.runs.resize(MEMBER_COUNT);
+    for (int m = 0; m < MEMBER_COUNT; m++) {
+        result.runs[m].algorithm = MEMBERS[m].name;
+    }
+    if (instance.size() == 0) {
+        order.clear();
+        result.algorithm = MEMBERS[0].name;
+        result.optimal = true;
+        return result;
+    }
+
+    {
+        ScratchArena arena;
+        result.lowerBound = schragePreemptivePlaning(instance, arena);
+    }
+
+    PortfolioShared shared(control, start);
+    {
+        const int threads = options.threadCount > 0 ? options.threadCount
+                                                    : static_cast<int>(std::thread::hardware_concurrency());
+        ThreadPool pool(std::min(std::max(threads, 1), MEMBER_COUNT));
+
+        for (int m = 0; m < MEMBER_COUNT; m++) {
+            pool.submit([&, m] {
+                ScratchArena arena;
+                std::vector<int> permutation;
+
+                AnytimeControl memberControl;
+                memberControl.stopToken = &shared.stop;
+                memberControl.deadline = deadline;
+                memberControl.onImprovement = [&shared, m](int Cmax, const std::vector<int> &solution) {
+                    std::lock_guard<std::mutex> lock(shared.mutex);
+                    shared.offer(m, Cmax, solution);
+                };
+
+                PortfolioRun &run = result.runs[m];
+                if (!shared.stop.load(std::memory_order_relaxed)) {
+                    run.Cmax = MEMBERS[m].run(instance, arena, permutation, options, memberControl);
+                    run.seconds = secondsSince(start);
+                }
+
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                if (run.Cmax >= 0) {
+                    shared.offer(m, run.Cmax, permutation);
+                }
+                shared.truncated = shared.truncated || memberControl.interrupted();
+                shared.remaining--;
+                shared.finished.notify_all();
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(shared.mutex);
+        auto done = [&] { return shared.remaining == 0 || shared.incumbent.load() <= result.lowerBound; };
+        // Zewnętrzna flaga przerwania nie budzi zmiennej warunkowej, więc czekamy w krótkich odcinkach
+        while (!done() && Clock::now() < deadline && !control.stopRequested()) {
+            shared.finished.wait_until(lock, std::min(deadline, Clock::now() + std::chrono::milliseconds(1)));
+        }
+        result.interrupted = !done();
+        shared.stop.store(true, std::memory_order_relaxed);
+        lock.unlock();
+        pool.wait();
+    }
+
+    result.Cmax = shared.incumbent.best(order);
+    result.algorithm = shared.bestAlgorithm;
+    result.secondsToBest = shared.secondsToBest;
+    result.totalSeconds = secondsSince(start);
+    result.optimal = result.Cmax <= result.lowerBound;
+    // Przerwanie po osiągnięciu dolnego ograniczenia nie skraca wyniku
+    result.interrupted = (result.interrupted || shared.truncated) && !result.optimal;
+    if (result.interrupted) {
+        // Własny limit czasu portfolio nie jest widoczny w control - zgłaszamy go jak przerwanie z zewnątrz
+        control.stopObserved.store(true, std::memory_order_relaxed);
+    }
+    return result;
+}
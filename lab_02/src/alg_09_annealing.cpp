@@ -0,0 +1,236 @@
+#include "alg_09_annealing.h"
+#include <algorithm>
+#include <cmath>
+#include "alg_01_schrage.h"
+#include "schedule_segment.h"
+#include "split_mix.h"
+
+namespace {
+
+/**
+ * @brief Drzewo przedziałowe fragmentów (Segment) nad pozycjami permutacji.
+ *
+ * Złożenie fragmentów jest łączne, więc węzeł przechowuje złożenie swoich dzieci, korzeń - całą
+ * permutację, a dowolny przedział pozycji składa się w O(log n). Ruch zmieniający pozycje lo..hi
+ * przelicza tylko te liście i ich przodków.
+ */
+class SegmentTree {
+private:
+    int size;       ///< Liczba liści (potęga dwójki >= n)
+    Segment *node;  ///< node[1] - korzeń, node[size + k] - zadanie na pozycji k
+
+public:
+    SegmentTree(int n, ScratchArena &arena) : size(1) {
+        while (size < n) {
+            size *= 2;
+        }
+        node = arena.allocate<Segment>(2 * static_cast<size_t>(size));
+        std::fill(node, node + 2 * static_cast<size_t>(size), Segment::empty());
+    }
+
+    void set(int k, const Segment &segment) { node[size + k] = segment; }
+
+    /**
+     * @brief Przelicza przodków liści lo..hi
+     */
+    void refresh(int lo, int hi) {
+        for (lo += size, hi += size; lo > 1;) {
+            lo >>= 1;
+            hi >>= 1;
+            for (int i = lo; i <= hi; i++) {
+                node[i] = node[2 * i].then(node[2 * i + 1]);
+            }
+        }
+    }
+
+    /**
+     * @brief Złożenie fragmentów na pozycjach lo..hi (pusty fragment, gdy lo > hi)
+     */
+    Segment query(int lo, int hi) const {
+        Segment left = Segment::empty(), right = Segment::empty();
+        for (int l = lo + size, r = hi + size + 1; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) {
+                left = left.then(node[l++]);
+            }
+            if (r & 1) {
+                right = node[--r].then(right);
+            }
+        }
+        return left.then(right);
+    }
+
+    int cmax() const { return node[1].value(0); }
+};
+
+/**
+ * @brief Stan wyżarzania: permutacja i drzewo jej fragmentów.
+ */
+struct AnnealingState {
+    const int *r, *p, *q;
+    int n;
+    int *perm;
+    SegmentTree tree;
+
+    Segment jobAt(int k) const {
+        const int j = perm[k];
+        return Segment::job(r[j], p[j], q[j]);
+    }
+
+    /**
+     * @brief Cmax po przeniesieniu zadania z pozycji from na pozycję to (sąsiednie - zamiana);
+     * składane są tylko fragmenty przed ruchem, przesuwane okno from..to i fragment za ruchem.
+     */
+    int evaluate(int from, int to) const {
+        const int lo = std::min(from, to), hi = std::max(from, to);
+        const Segment middle = from < to ? tree.query(from + 1, to).then(jobAt(from))
+                                         : jobAt(from).then(tree.query(to, from - 1));
+        return tree.query(0, lo - 1).then(middle).then(tree.query(hi + 1, n - 1)).value(0);
+    }
+
+    void apply(int from, int to) {
+        const int lo = std::min(from, to), hi = std::max(from, to);
+        if (from < to) {
+            std::rotate(perm + from, perm + from + 1, perm + to + 1);
+        } else {
+            std::rotate(perm + to, perm + from, perm + from + 1);
+        }
+        for (int k = lo; k <= hi; k++) {
+            tree.set(k, jobAt(k));
+        }
+        tree.refresh(lo, hi);
+    }
+};
+
+/**
+ * @brief Losuje ruch: zamianę sąsiednich zadań albo przeniesienie o co najwyżej maxShift pozycji
+ */
+void randomMove(SplitMix64 &random, int n, const AnnealingOptions &options, int &from, int &to) {
+    if (random.unit() < options.swapShare) {
+        from = random.below(n - 1);
+        to = from + 1;
+        return;
+    }
+    from = random.below(n);
+    const int shift = 1 + random.below(std::max(options.maxShift, 1));
+    to = random.below(2) == 0 ? std::max(from - shift, 0) : std::min(from + shift, n - 1);
+    if (to == from) {
+        to = from == 0 ? 1 : from - 1;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Symulowane wyżarzanie dla problemu 1|r_j,q_j|Cmax startujące z permutacji Schrage.
+ *
+ * Ruchy to zamiany sąsiednich zadań i przeniesienia zadania o co najwyżej options.maxShift pozycji.
+ * Permutacja przechowywana jest w drzewie przedziałowym fragmentów (Segment), więc ocena ruchu to
+ * złożenie fragmentu przed ruchem, przesuwanego okna i fragmentu za nim w O(log n), a wykonanie
+ * ruchu przelicza tylko okno i jego przodków - bez przeliczania wszystkich n zadań. Gorszy ruch
+ * o delta jest przyjmowany z prawdopodobieństwem exp(-delta / T); temperatura maleje geometrycznie
+ * od options.startTemperature do options.endTemperature. Przeszukiwanie kończy się po
+ * options.maxMoves ruchach albo po osiągnięciu dolnego ograniczenia (Schrage z wywłaszczaniem; tylko
+ * z options.stopAtLowerBound).
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry wyżarzania.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int simulatedAnnealingPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                              const AnnealingOptions &options) {
+    return simulatedAnnealingPlaning(instance, arena, order, options, AnytimeControl());
+}
+
+/**
+ * @brief Symulowane wyżarzanie z możliwością przerwania.
+ *
+ * Przerwanie sprawdzane jest co 1024 ruchy; rozwiązanie startowe i każde kolejne lepsze trafiają
+ * do control.improved.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry wyżarzania.
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int simulatedAnnealingPlaning(const Instance &instance, ScratchArena &arena, std::vector<int> &order,
+                              const AnnealingOptions &options, const AnytimeControl &control) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+    if (n < 2) {
+        return schragePlaning(instance, arena, order);
+    }
+
+    AnnealingState s{instance.r(), instance.p(), instance.q(), n, arena.allocate<int>(n), SegmentTree(n, arena)};
+    schragePlaning(instance, arena, s.perm);
+    for (int k = 0; k < n; k++) {
+        s.tree.set(k, s.jobAt(k));
+    }
+    s.tree.refresh(0, n - 1);
+
+    const int LB = schragePreemptivePlaning(instance, arena);
+    int Cmax = s.tree.cmax();
+    int bestCmax = Cmax;
+    order.assign(s.perm, s.perm + n);
+    control.improved(bestCmax, order);
+
+    SplitMix64 random{options.seed};
+    int from, to;
+
+    // Temperatura początkowa: średnie pogorszenie z próbki ruchów przyjmowane z prawdopodobieństwem 1/2
+    double T0 = options.startTemperature;
+    if (T0 < 0) {
+        double worse = 0;
+        int count = 0;
+        for (int k = 0; k < 256; k++) {
+            randomMove(random, n, options, from, to);
+            const int delta = s.evaluate(from, to) - Cmax;
+            if (delta > 0) {
+                worse += delta;
+                count++;
+            }
+        }
+        T0 = count > 0 ? worse / count / std::log(2.0) : 1.0;
+    }
+    const double T1 = options.endTemperature >= 0 ? options.endTemperature : T0 / 1000;
+    const double cooling = options.maxMoves > 0 ? std::pow(std::max(T1, 1e-9) / T0, 1.0 / options.maxMoves) : 1;
+    double T = T0;
+
+    // Najlepszą permutację kopiujemy dopiero przed pierwszym gorszym ruchem (albo dla control.improved),
+    // a nie przy każdej poprawie - na początku wyżarzania poprawy są bardzo częste
+    bool saved = true;
+    AnytimePoller poller(control);
+    const int stopAt = options.stopAtLowerBound ? LB : -1;
+    for (long move = 0; move < options.maxMoves && bestCmax > stopAt && !poller.shouldStop(); move++) {
+        randomMove(random, n, options, from, to);
+        const int value = s.evaluate(from, to);
+        const int delta = value - Cmax;
+        if (delta <= 0 || random.unit() < std::exp(-delta / T)) {
+            if (delta > 0 && !saved) {
+                order.assign(s.perm, s.perm + n);
+                saved = true;
+            }
+            s.apply(from, to);
+            Cmax = value;
+            if (Cmax < bestCmax) {
+                bestCmax = Cmax;
+                saved = false;
+                if (control.onImprovement) {
+                    order.assign(s.perm, s.perm + n);
+                    saved = true;
+                    control.improved(bestCmax, order);
+                }
+            }
+        }
+        T *= cooling;
+    }
+
+    // Od ostatniej poprawy były tylko ruchy neutralne, więc bieżąca permutacja ma Cmax = bestCmax
+    if (!saved) {
+        order.assign(s.perm, s.perm + n);
+    }
+    return bestCmax;
+}
@@ -0,0 +1,342 @@
+#include "alg_10_genetic.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "alg_01_schrage.h"
+#include "cmax_eval.h"
+#include "incumbent.h"
+#include "scratch_arena.h"
+#include "split_mix.h"
+
+namespace {
+
+/**
+ * @class MigrationChannel
+ * @brief Kanał migrantów między dwiema wyspami (jeden nadawca, jeden odbiorca) bez blokad.
+ *
+ * Potrójny bufor: nadawca pisze do swojego slotu i atomowo wymienia go ze slotem środkowym,
+ * odbiorca - jeśli środkowy slot jest świeży - wymienia go ze swoim. Każdy slot należy w danej
+ * chwili do dokładnie jednej strony, więc żadna nie czeka na drugą, a odbiorca zawsze dostaje
+ * ostatnią pełną przesyłkę.
+ */
+class MigrationChannel {
+private:
+    static constexpr int FRESH = 4;  ///< Bit "środkowy slot zawiera nieodebraną przesyłkę"
+
+    int *slots = nullptr;            ///< Trzy sloty po slotSize liczb
+    size_t slotSize = 0;
+    std::atomic<int> middle{2};      ///< Indeks slotu środkowego | FRESH
+    int back = 0;                    ///< Slot nadawcy
+    int front = 1;                   ///< Slot odbiorcy
+
+public:
+    void attach(int *storage, size_t size) {
+        slots = storage;
+        slotSize = size;
+    }
+
+    /**
+     * @brief Slot, do którego nadawca zapisuje przesyłkę
+     */
+    int *outbox() { return slots + back * slotSize; }
+
+    /**
+     * @brief Udostępnia zapisaną przesyłkę odbiorcy
+     */
+    void publish() { back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & 3; }
+
+    /**
+     * @brief Odbiera najnowszą przesyłkę
+     * @return Przesyłka albo nullptr, jeśli od ostatniego odbioru nic nie wysłano
+     */
+    const int *receive() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) {
+            return nullptr;
+        }
+        front = middle.exchange(front, std::memory_order_acq_rel) & 3;
+        return slots + front * slotSize;
+    }
+};
+
+/**
+ * @brief Dane współdzielone przez wyspy.
+ */
+struct GeneticShared {
+    const Instance &instance;
+    const GeneticOptions &options;
+    const std::vector<int> &start;           ///< Permutacja Schrage - zaczątek populacji
+    int islands;
+    int lowerBound;                          ///< Schrage z wywłaszczaniem
+    Incumbent best;                          ///< Najlepsze rozwiązanie wszystkich wysp
+    std::atomic<bool> stop{false};           ///< Osiągnięto dolne ograniczenie albo przerwano
+    std::vector<MigrationChannel> channels;  ///< channels[i] - od wyspy i do wyspy i + 1
+    std::vector<int> mailboxes;              ///< Pamięć slotów wszystkich kanałów
+
+    GeneticShared(const Instance &instance, const GeneticOptions &options, const std::vector<int> &start,
+                  int islands, int lowerBound, const AnytimeControl &control)
+            : instance(instance), options(options), start(start), islands(islands), lowerBound(lowerBound),
+              best(&control), channels(islands),
+              mailboxes(static_cast<size_t>(islands) * 3 * std::max(options.migrants, 0) * (instance.size() + 1)) {
+        const size_t slot = static_cast<size_t>(std::max(options.migrants, 0)) * (instance.size() + 1);
+        for (int i = 0; i < islands; i++) {
+            channels[i].attach(mailboxes.data() + i * 3 * slot, slot);
+        }
+    }
+};
+
+/**
+ * @brief Populacja jednej wyspy w płaskich buforach: osobnik k zajmuje pozycje k*n..k*n+n-1.
+ */
+struct Island {
+    int n, size;
+    int *population, *fitness;  ///< Bieżące pokolenie
+    int *children, *childFitness; ///< Następne pokolenie
+    int *stamp;                 ///< Znaczniki zadań użytych w krzyżowaniu (porównywane ze stampValue)
+    int stampValue = 0;
+    int *position;              ///< Pozycje zadań w drugim rodzicu (PMX)
+    int *selected;              ///< Indeksy najlepszych / najgorszych osobników
+    SplitMix64 random;
+
+    Island(int n, int size, ScratchArena &arena, uint64_t seed)
+            : n(n), size(size),
+              population(arena.allocate<int>(static_cast<size_t>(size) * n)), fitness(arena.allocate<int>(size)),
+              children(arena.allocate<int>(static_cast<size_t>(size) * n)), childFitness(arena.allocate<int>(size)),
+              stamp(arena.allocate<int>(n)), position(arena.allocate<int>(n)),
+              selected(arena.allocate<int>(size)), random{seed} {
+        std::fill(stamp, stamp + n, 0);
+    }
+
+    int *individual(int k) { return population + static_cast<size_t>(k) * n; }
+
+    /**
+     * @brief Wpisuje do selected indeksy count osobników o najmniejszym (worst = false)
+     * albo największym Cmax; count jest małe, więc wystarcza wybór częściowy
+     */
+    void extremes(int count, bool worst) {
+        for (int k = 0; k < size; k++) {
+            selected[k] = k;
+        }
+        std::partial_sort(selected, selected + count, selected + size, [&](int a, int b) {
+            return worst ? fitness[a] > fitness[b] : fitness[a] < fitness[b];
+        });
+    }
+
+    /**
+     * @brief Turniej dwóch losowych osobników
+     */
+    int tournament() {
+        const int a = random.below(size), b = random.below(size);
+        return fitness[a] <= fitness[b] ? a : b;
+    }
+
+    /**
+     * @brief Order crossover: child[i..j] = a[i..j], pozostałe pozycje od j + 1 w kolejności z b
+     */
+    void orderCrossover(const int *a, const int *b, int *child, int i, int j) {
+        stampValue++;
+        for (int k = i; k <= j; k++) {
+            child[k] = a[k];
+            stamp[a[k]] = stampValue;
+        }
+        int pos = (j + 1) % n;
+        for (int t = 0, k = (j + 1) % n; t < n; t++, k = k + 1 == n ? 0 : k + 1) {
+            if (stamp[b[k]] != stampValue) {
+                child[pos] = b[k];
+                pos = pos + 1 == n ? 0 : pos + 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Partially mapped crossover: child[i..j] = a[i..j], reszta z b; zadanie z b wyparte
+     * z fragmentu trafia na pozycję wyznaczoną łańcuchem odwzorowań a[k] -> pozycja w b
+     */
+    void mappedCrossover(const int *a, const int *b, int *child, int i, int j) {
+        stampValue++;
+        for (int k = 0; k < n; k++) {
+            position[b[k]] = k;
+            child[k] = b[k];
+        }
+        for (int k = i; k <= j; k++) {
+            child[k] = a[k];
+            stamp[a[k]] = stampValue;
+        }
+        for (int k = i; k <= j; k++) {
+            if (stamp[b[k]] == stampValue) {
+                continue;
+            }
+            int pos = k;
+            while (pos >= i && pos <= j) {
+                pos = position[a[pos]];
+            }
+            child[pos] = b[k];
+        }
+    }
+};
+
+/**
+ * @brief Przebieg jednej wyspy: ewolucja, zgłaszanie popraw i wymiana migrantów z sąsiadami w pierścieniu.
+ */
+void evolveIsland(GeneticShared &shared, int id, const AnytimeControl &control) {
+    const GeneticOptions &options = shared.options;
+    const Instance &instance = shared.instance;
+    const int n = instance.size();
+    const int size = std::max(options.populationSize, 2);
+    const int elite = std::clamp(options.elite, 0, size - 1);
+    const int migrants = std::clamp(options.migrants, 0, size - 1);
+
+    ScratchArena arena;
+    Island island(n, size, arena, options.seed + SPLIT_MIX_GAMMA * id);
+
+    // Populacja startowa: permutacja Schrage i jej kopie z losowymi zamianami sąsiednich zadań
+    for (int k = 0; k < size; k++) {
+        int *perm = island.individual(k);
+        std::copy(shared.start.begin(), shared.start.end(), perm);
+        const int swaps = k == 0 || n < 2 ? 0 : 1 + island.random.below(std::max(n / 8, 1));
+        for (int s = 0; s < swaps; s++) {
+            const int i = island.random.below(n - 1);
+            std::swap(perm[i], perm[i + 1]);
+        }
+    }
+    evaluateCmaxBatch(instance, island.population, size, island.fitness);
+
+    int islandBest = INT_MAX;
+    MigrationChannel &outgoing = shared.channels[id];
+    MigrationChannel &incoming = shared.channels[(id + shared.islands - 1) % shared.islands];
+
+    // Wybiera najlepszych (island.selected) i zgłasza lidera, jeśli poprawił wynik wyspy
+    auto offerLeader = [&] {
+        island.extremes(std::max({elite, migrants, 1}), false);
+        const int leader = island.selected[0];
+        if (island.fitness[leader] < islandBest) {
+            islandBest = island.fitness[leader];
+            const int *perm = island.individual(leader);
+            shared.best.offer(islandBest, perm, perm + n);
+            if (options.stopAtLowerBound && shared.best.load() <= shared.lowerBound) {
+                shared.stop.store(true, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    for (int generation = 1; generation <= options.generations; generation++) {
+        offerLeader();
+        if (shared.stop.load(std::memory_order_relaxed) || control.stopRequested()) {
+            break;
+        }
+
+        // Migracja: najlepsi do następnej wyspy, najnowsza przesyłka od poprzedniej zastępuje najgorszych
+        if (shared.islands > 1 && migrants > 0 && generation % std::max(options.migrationInterval, 1) == 0) {
+            int *box = outgoing.outbox();
+            for (int m = 0; m < migrants; m++) {
+                const int k = island.selected[m];
+                box[m * (n + 1)] = island.fitness[k];
+                std::copy(island.individual(k), island.individual(k) + n, box + m * (n + 1) + 1);
+            }
+            outgoing.publish();
+
+            if (const int *received = incoming.receive()) {
+                island.extremes(migrants, true);
+                for (int m = 0; m < migrants; m++) {
+                    const int k = island.selected[m];
+                    if (received[m * (n + 1)] < island.fitness[k]) {
+                        island.fitness[k] = received[m * (n + 1)];
+                        std::copy(received + m * (n + 1) + 1, received + (m + 1) * (n + 1), island.individual(k));
+                    }
+                }
+                island.extremes(elite, false);
+            }
+        }
+
+        // Elita przechodzi bez zmian, pozostałe miejsca zajmują potomkowie turniejowo wybranych rodziców
+        for (int e = 0; e < elite; e++) {
+            const int k = island.selected[e];
+            std::copy(island.individual(k), island.individual(k) + n, island.children + static_cast<size_t>(e) * n);
+            island.childFitness[e] = island.fitness[k];
+        }
+        for (int c = elite; c < size; c++) {
+            int *child = island.children + static_cast<size_t>(c) * n;
+            const int *a = island.individual(island.tournament()), *b = island.individual(island.tournament());
+            int i = island.random.below(n), j = island.random.below(n);
+            if (i > j) {
+                std::swap(i, j);
+            }
+            if (options.crossover == Crossover::PMX) {
+                island.mappedCrossover(a, b, child, i, j);
+            } else {
+                island.orderCrossover(a, b, child, i, j);
+            }
+            if (island.random.unit() < options.mutationRate) {
+                std::swap(child[island.random.below(n)], child[island.random.below(n)]);
+            }
+        }
+
+        // Ocena całego pokolenia jednym wywołaniem (wektorowo dla wielu permutacji naraz)
+        evaluateCmaxBatch(instance, island.children + static_cast<size_t>(elite) * n, size - elite,
+                          island.childFitness + elite);
+        std::swap(island.population, island.children);
+        std::swap(island.fitness, island.childFitness);
+    }
+
+    // Potomkowie ostatniego pokolenia nie przeszli jeszcze przez offerLeader
+    offerLeader();
+}
+
+} // namespace
+
+/**
+ * @brief Algorytm genetyczny z modelem wysp dla problemu 1|r_j,q_j|Cmax.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry algorytmu.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int geneticPlaning(const Instance &instance, std::vector<int> &order, const GeneticOptions &options) {
+    return geneticPlaning(instance, order, options, AnytimeControl());
+}
+
+/**
+ * @brief Algorytm genetyczny z modelem wysp i możliwością przerwania.
+ *
+ * Każda wyspa działa w osobnym wątku i trzyma populację w płaskich buforach przydzielonych raz
+ * na początku; potomkowie powstają przez krzyżowanie OX lub PMX rodziców wybranych turniejowo
+ * i mutację (zamianę dwóch zadań), a całe pokolenie oceniane jest jednym wywołaniem
+ * evaluateCmaxBatch. Co options.migrationInterval pokoleń wyspa wysyła najlepszych osobników
+ * do następnej wyspy w pierścieniu przez kanał bez blokad. Wyspy kończą po options.generations
+ * pokoleniach, po osiągnięciu dolnego ograniczenia (Schrage z wywłaszczaniem, jeśli
+ * options.stopAtLowerBound) albo po przerwaniu
+ * z control (sprawdzanym co pokolenie); każda poprawa wspólnego wyniku trafia do control.improved.
+ * Dla jednej wyspy wynik zależy tylko od ziarna; przy wielu wyspach także od chwili migracji.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor, który otrzyma najlepszą znalezioną permutację (indeksy zadań).
+ * @param options Parametry algorytmu.
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw.
+ * @return Cmax najlepszej znalezionej permutacji.
+ */
+int geneticPlaning(const Instance &instance, std::vector<int> &order, const GeneticOptions &options,
+                   const AnytimeControl &control) {
+    const int n = instance.size();
+    ScratchArena arena;
+    std::vector<int> start;
+    const int schrage = schragePlaning(instance, arena, start);
+    if (n < 2) {
+        order = start;
+        return schrage;
+    }
+
+    const int islands = options.islands > 0 ? options.islands
+                                            : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    GeneticShared shared(instance, options, start, islands, schragePreemptivePlaning(instance, arena), control);
+
+    std::vector<std::thread> workers;
+    for (int id = 1; id < islands; id++) {
+        workers.emplace_back(evolveIsland, std::ref(shared), id, std::cref(control));
+    }
+    evolveIsland(shared, 0, control);
+    for (auto &worker: workers) {
+        worker.join();
+    }
+
+    return shared.best.best(order);
+}
@@ -0,0 +1,102 @@
+#include "algorithm_registry.h"
+#include "alg_00_heuristic.h"
+#include "alg_01_schrage.h"
+#include "alg_02_brute_force.h"
+#include "alg_03_wspt.h"
+#include "alg_04_carlier.h"
+#include "alg_05_carlier_parallel.h"
+#include "alg_06_bitmask_dp.h"
+#include "alg_07_tabu.h"
+#include "alg_08_portfolio.h"
+#include "alg_09_annealing.h"
+#include "alg_10_genetic.h"
+#include "wspt_tuner.h"
+
+/**
+ * @brief Zwraca listę wszystkich algorytmów w kolejności, w jakiej wypisuje je program główny.
+ *
+ * W run algorytmy równoległe dostają liczbę wątków równą liczbie rdzeni; runControlled przyjmuje
+ * liczbę wątków i sterowanie przerwaniem (algorytmy bez runControlled są jednowątkowe i szybkie).
+ *
+ * @return Niezmienna lista algorytmów.
+ */
+const std::vector<AlgorithmInfo> &algorithms() {
+    static const std::vector<AlgorithmInfo> list = {
+            {"qj_sort", qjSortPlaning, INT_MAX, true, false},
+            {"rj_sort", rjSortPlaning, INT_MAX, true, false},
+            {"qj_sort_radix", qjSortRadixPlaning, INT_MAX, true, false},
+            {"rj_sort_radix", rjSortRadixPlaning, INT_MAX, true, false},
+            {"brute_force",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return bruteForce(instance, arena, order); },
+             12, true, true,
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control, int) { return bruteForce(instance, arena, order, control); }},
+            {"brute_force_parallel",
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order) { return bruteForceParallel(instance, order, 0); },
+             12, true, true,
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order, const AnytimeControl &control, int threads) { return bruteForceParallel(instance, order, threads, control); }},
+            {"bitmask_dp", bitmaskDPPlaning, 20, true, true},
+            {"schrage",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return schragePlaning(instance, arena, order); },
+             INT_MAX, true, false},
+            {"schrage_preemptive",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &) { return schragePreemptivePlaning(instance, arena); },
+             INT_MAX, false, false},
+            {"wspt", weightedSPTPlaning, INT_MAX, true, false},
+            {"wspt_tuned",
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order) { return tuneWsptWeights(instance, order).Cmax; },
+             INT_MAX, true, false,
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order, const AnytimeControl &, int threads) {
+                 WsptTunerOptions options;
+                 options.threadCount = threads;
+                 return tuneWsptWeights(instance, order, options).Cmax;
+             }},
+            {"tabu",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return tabuSearchPlaning(instance, arena, order); },
+             INT_MAX, true, false,
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control, int) { return tabuSearchPlaning(instance, arena, order, TabuOptions(), control); }},
+            {"annealing",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return simulatedAnnealingPlaning(instance, arena, order); },
+             INT_MAX, true, false,
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control, int) { return simulatedAnnealingPlaning(instance, arena, order, AnnealingOptions(), control); }},
+            {"genetic",
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order) { return geneticPlaning(instance, order); },
+             10000, true, false,
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order, const AnytimeControl &control, int threads) {
+                 GeneticOptions options;
+                 options.islands = threads;
+                 return geneticPlaning(instance, order, options, control);
+             }},
+            {"portfolio",
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order) { return portfolioPlaning(instance, order).Cmax; },
+             INT_MAX, true, false,
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order, const AnytimeControl &control, int threads) {
+                 PortfolioOptions options;
+                 options.threadCount = threads;
+                 return portfolioPlaning(instance, order, options, control).Cmax;
+             }},
+            {"carlier",
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return carlierPlaning(instance, arena, order); },
+             INT_MAX, true, true,
+             [](const Instance &instance, ScratchArena &arena, std::vector<int> &order, const AnytimeControl &control, int) { return carlierPlaning(instance, arena, order, control); }},
+            {"carlier_parallel",
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order) { return carlierParallelPlaning(instance, order, 0); },
+             INT_MAX, true, true,
+             [](const Instance &instance, ScratchArena &, std::vector<int> &order, const AnytimeControl &control, int threads) { return carlierParallelPlaning(instance, order, threads, control); }},
+    };
+    return list;
+}
+
+/**
+ * @brief Wyszukuje algorytm po nazwie.
+ *
+ * @param name Nazwa algorytmu (pole AlgorithmInfo::name).
+ * @return Opis algorytmu albo nullptr, jeśli nie ma algorytmu o tej nazwie.
+ */
+const AlgorithmInfo *findAlgorithm(const std::string &name) {
+    for (const AlgorithmInfo &algorithm: algorithms()) {
+        if (name == algorithm.name) {
+            return &algorithm;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,385 @@
+#include "batch_runner.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <glob.h>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sys/stat.h>
+#include "algorithm_registry.h"
+#include "allocation_counter.h"
+#include "cmax_eval.h"
+#include "instance_io.h"
+#include "instrumentation.h"
+#include "lower_bound.h"
+#include "thread_pool.h"
+
+namespace {
+
+/// Liczba instancji rozwiązywanych jednocześnie; następna jest w tym czasie wczytywana
+constexpr int INSTANCES_IN_FLIGHT = 2;
+
+/**
+ * @brief Wynik jednej pary (instancja, algorytm).
+ */
+struct BatchRow {
+    std::string instance;
+    const AlgorithmInfo *algorithm = nullptr;
+    int n = 0;
+    int Cmax = -1;
+    int expected = -1;          ///< Wartość z pliku .out (-1 - brak pliku)
+    int lowerBound = 0;         ///< Dolne ograniczenie instancji (LowerBounds::best)
+    double seconds = 0;
+    long allocations = 0;
+    std::string status;         ///< ok, invalid, above_expected, timeout, skipped
+    instrumentation::Sample sample;  ///< Liczniki przebiegu (puste bez INSTRUMENTATION=ON)
+};
+
+/**
+ * @brief Dodaje do wyniku pliki pasujące do wzorca (pomijając pliki .out z wynikami wzorcowymi)
+ */
+bool globFiles(const std::string &pattern, std::vector<std::string> &files) {
+    glob_t matches{};
+    int status = glob(pattern.c_str(), 0, nullptr, &matches);
+    if (status == 0) {
+        for (size_t i = 0; i < matches.gl_pathc; i++) {
+            std::string path = matches.gl_pathv[i];
+            if (path.size() < 4 || path.compare(path.size() - 4, 4, ".out") != 0) {
+                files.push_back(path);
+            }
+        }
+    }
+    globfree(&matches);
+    return status == 0 || status == GLOB_NOMATCH;
+}
+
+/**
+ * @brief Wczytuje wartość oczekiwaną z pliku o tej samej nazwie i rozszerzeniu .out
+ * @return Wartość z pliku albo -1, jeśli pliku nie ma
+ */
+int readExpected(const std::string &path) {
+    const size_t dot = path.find_last_of('.');
+    const size_t slash = path.find_last_of('/');
+    const std::string stem = dot != std::string::npos && (slash == std::string::npos || dot > slash)
+                             ? path.substr(0, dot) : path;
+
+    return readCorrectOutcome(stem + ".out").value;
+}
+
+/**
+ * @brief Sprawdza, czy order jest permutacją zadań o wartości Cmax
+ */
+bool validOrder(const Instance &instance, const std::vector<int> &order, int Cmax) {
+    if (static_cast<int>(order.size()) != instance.size()) {
+        return false;
+    }
+    std::vector<char> seen(order.size(), 0);
+    for (int j: order) {
+        if (j < 0 || j >= instance.size() || seen[j]) {
+            return false;
+        }
+        seen[j] = 1;
+    }
+    return evaluateCmax(instance, order.data()) == Cmax;
+}
+
+/**
+ * @brief Uruchamia jeden algorytm na jednej instancji i wypełnia wiersz wyniku.
+ *
+ * Algorytmy działają jednowątkowo - równoległość zapewnia pula trybu wsadowego, więc liczba wątków
+ * nie przekracza jej rozmiaru. Algorytm z runControlled dostaje termin timeLimitSeconds; przerwany
+ * zwraca najlepsze dotąd rozwiązanie, a wiersz ma status timeout. W kompilacji z instrumentacją wiersz
+ * dostaje też liczniki przebiegu (algorytm działa w całości na wątku, który go wywołał).
+ */
+void solve(const Instance &instance, double timeLimitSeconds, BatchRow &row) {
+    const AlgorithmInfo &algorithm = *row.algorithm;
+    if (instance.size() > algorithm.maxTasks) {
+        row.status = "skipped";
+        return;
+    }
+
+    // Pamięć robocza żyje w wątku puli i jest używana przez kolejne zadania tego wątku
+    thread_local ScratchArena arena;
+    thread_local std::vector<int> order;
+
+    AnytimeControl control;
+    if (timeLimitSeconds > 0) {
+        control.setTimeLimit(timeLimitSeconds);
+    }
+
+    instrumentation::Probe probe;
+    const long allocationsBefore = threadAllocations();
+    auto start = std::chrono::steady_clock::now();
+    row.Cmax = algorithm.runControlled ? algorithm.runControlled(instance, arena, order, control, 1)
+                                       : algorithm.run(instance, arena, order);
+    auto end = std::chrono::steady_clock::now();
+    row.allocations = threadAllocations() - allocationsBefore;
+    row.sample = probe.finish();
+    row.seconds = std::chrono::duration<double>(end - start).count();
+
+    if (row.Cmax < row.lowerBound || (algorithm.producesOrder && !validOrder(instance, order, row.Cmax))) {
+        row.status = "invalid";
+    } else if (control.interrupted()) {
+        row.status = "timeout";
+    } else if (algorithm.exact && row.expected >= 0 && row.Cmax > row.expected) {
+        // Plik .out zawiera wartość osiągalnego rozwiązania - algorytm dokładny nie może być gorszy
+        row.status = "above_expected";
+    } else {
+        row.status = "ok";
+    }
+}
+
+std::string csvField(const std::string &text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (char c: text) {
+        quoted += c == '"' ? "\"\"" : std::string(1, c);
+    }
+    return quoted + "\"";
+}
+
+std::string jsonString(const std::string &text) {
+    std::string quoted = "\"";
+    for (char c: text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            quoted += escaped;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+void writeRows(const std::vector<BatchRow> &rows, BatchFormat format, std::ostream &out) {
+    out << std::fixed;
+    if (format == BatchFormat::CSV) {
+        out << "instance,algorithm,n,cmax,expected,gap_percent,lower_bound,lb_gap_percent,time_ms,allocations,status"
+            << (instrumentation::ENABLED ? instrumentation::csvHeader() : "") << '\n';
+    } else {
+        out << "[\n";
+    }
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        const BatchRow &row = rows[i];
+        const bool solved = row.status != "skipped";
+        const bool hasExpected = solved && row.expected > 0;
+        const double gap = hasExpected ? 100.0 * (row.Cmax - row.expected) / row.expected : 0;
+
+        if (format == BatchFormat::CSV) {
+            out << csvField(row.instance) << ',' << row.algorithm->name << ',' << row.n << ',';
+            if (solved) {
+                out << row.Cmax;
+            }
+            out << ',';
+            if (row.expected >= 0) {
+                out << row.expected;
+            }
+            out << ',';
+            if (hasExpected) {
+                out << std::setprecision(3) << gap;
+            }
+            out << ',' << row.lowerBound << ',';
+            if (solved) {
+                out << std::setprecision(3) << optimalityGap(row.Cmax, row.lowerBound);
+            }
+            out << ',';
+            if (solved) {
+                out << std::setprecision(4) << row.seconds * 1e3 << ',' << row.allocations;
+            } else {
+                out << ',';
+            }
+            out << ',' << row.status;
+            if (instrumentation::ENABLED) {
+                // Pominięty wiersz ma puste kolumny liczników
+                out << (solved ? instrumentation::csvRow(row.sample)
+                               : std::string(instrumentation::COUNTERS + instrumentation::PHASES + 3, ','));
+            }
+            out << '\n';
+        } else {
+            auto number = [&](bool present, auto value) {
+                if (present) {
+                    out << value;
+                } else {
+                    out << "null";
+                }
+            };
+            out << "  {\"instance\": " << jsonString(row.instance) << ", \"algorithm\": \"" << row.algorithm->name
+                << "\", \"n\": " << row.n << ", \"cmax\": ";
+            number(solved, row.Cmax);
+            out << ", \"expected\": ";
+            number(row.expected >= 0, row.expected);
+            out << ", \"gap_percent\": " << std::setprecision(3);
+            number(hasExpected, gap);
+            out << ", \"lower_bound\": " << row.lowerBound << ", \"lb_gap_percent\": ";
+            number(solved, optimalityGap(row.Cmax, row.lowerBound));
+            out << ", \"time_ms\": " << std::setprecision(4);
+            number(solved, row.seconds * 1e3);
+            out << ", \"allocations\": ";
+            number(solved, row.allocations);
+            out << ", \"status\": \"" << row.status << '"';
+            if (instrumentation::ENABLED) {
+                out << ", \"instrumentation\": ";
+                number(solved, instrumentation::jsonObject(row.sample));
+            }
+            out << '}' << (i + 1 < rows.size() ? "," : "") << '\n';
+        }
+    }
+
+    if (format == BatchFormat::JSON) {
+        out << "]\n";
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Rozwija listę wejść trybu wsadowego w listę plików.
+ *
+ * Katalog oznacza wszystkie pliki *.dat i *.bin w tym katalogu, napis z *, ? lub [ jest wzorcem glob,
+ * a każdy inny napis - pojedynczym plikiem. Pliki .out (wyniki wzorcowe) są pomijane.
+ *
+ * @param inputs Katalogi, wzorce lub pliki.
+ * @param error Otrzymuje opis błędu.
+ * @return Lista plików (w obrębie jednego wejścia posortowana) albo pusta lista w razie błędu.
+ */
+std::vector<std::string> expandInputs(const std::vector<std::string> &inputs, std::string &error) {
+    std::vector<std::string> files;
+    for (const std::string &input: inputs) {
+        const size_t first = files.size();
+        struct stat info{};
+        bool ok = true;
+        if (stat(input.c_str(), &info) == 0 && S_ISDIR(info.st_mode)) {
+            ok = globFiles(input + "/*.dat", files) && globFiles(input + "/*.bin", files);
+        } else if (input.find_first_of("*?[") != std::string::npos) {
+            ok = globFiles(input, files);
+        } else {
+            files.push_back(input);
+        }
+
+        if (!ok) {
+            error = "Błąd rozwijania wzorca: " + input;
+            return {};
+        }
+        if (files.size() == first) {
+            error = "Brak instancji pasujących do: " + input;
+            return {};
+        }
+        std::sort(files.begin() + static_cast<long>(first), files.end());
+    }
+    return files;
+}
+
+/**
+ * @brief Tryb wsadowy: każda para (instancja, algorytm) rozwiązywana jest w puli wątków.
+ *
+ * Wątek wywołujący wczytuje kolejną instancję, podczas gdy pula rozwiązuje poprzednie (co najwyżej
+ * INSTANCES_IN_FLIGHT naraz). Dla każdej pary zapisywany jest Cmax, wartość z pliku .out, różnica
+ * procentowa, dolne ograniczenie instancji (liczone przy wczytywaniu) i odległość od niego, czas, liczba
+ * alokacji w czasie działania algorytmu i status: ok, invalid (niepoprawna permutacja albo Cmax poniżej
+ * dolnego ograniczenia), above_expected (algorytm dokładny gorszy niż plik .out), timeout (przerwany po
+ * options.timeLimitSeconds - wynik to najlepsze znalezione rozwiązanie) albo skipped (instancja za duża
+ * dla algorytmu). Algorytmy w puli działają jednowątkowo. Wiersze wypisywane są w kolejności instancji
+ * i algorytmów. W kompilacji z instrumentacją (INSTRUMENTATION=ON) wiersz CSV ma dodatkowe kolumny
+ * liczników (instrumentation::csvHeader), a obiekt JSON pole "instrumentation" z tymi samymi licznikami.
+ *
+ * @param options Parametry trybu wsadowego.
+ * @param out Strumień na wyniki (CSV albo JSON).
+ * @param err Strumień na komunikaty o błędach.
+ * @return Kod wyjścia programu: 0, jeśli wszystko się powiodło i żaden wynik nie jest niepoprawny.
+ */
+int runBatch(const BatchOptions &options, std::ostream &out, std::ostream &err) {
+    std::vector<const AlgorithmInfo *> selected;
+    if (options.algorithms.empty()) {
+        for (const AlgorithmInfo &algorithm: algorithms()) {
+            selected.push_back(&algorithm);
+        }
+    }
+    for (const std::string &name: options.algorithms) {
+        const AlgorithmInfo *algorithm = findAlgorithm(name);
+        if (!algorithm) {
+            err << "Nieznany algorytm: " << name << std::endl;
+            return 1;
+        }
+        selected.push_back(algorithm);
+    }
+
+    std::string error;
+    const std::vector<std::string> files = expandInputs(options.inputs, error);
+    if (files.empty()) {
+        err << error << std::endl;
+        return 1;
+    }
+
+    std::vector<BatchRow> rows(files.size() * selected.size());
+    ScratchArena boundArena;
+    std::vector<char> loaded(files.size(), 0);
+    std::mutex mutex;
+    std::condition_variable instanceDone;
+    int inFlight = 0;
+
+    {
+        ThreadPool pool(options.threadCount);
+        for (size_t f = 0; f < files.size(); f++) {
+            // Wczytywanie odbywa się, gdy pula wciąż rozwiązuje poprzednie instancje
+            LoadResult result = loadInstance(files[f]);
+            if (!result) {
+                err << result.error << std::endl;
+                continue;
+            }
+            loaded[f] = 1;
+            const int expected = readExpected(files[f]);
+            const int lowerBound = lowerBounds(result.instance, boundArena).best();
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                instanceDone.wait(lock, [&] { return inFlight < INSTANCES_IN_FLIGHT; });
+                inFlight++;
+            }
+
+            auto instance = std::make_shared<const Instance>(std::move(result.instance));
+            auto remaining = std::make_shared<std::atomic<int>>(static_cast<int>(selected.size()));
+            for (size_t a = 0; a < selected.size(); a++) {
+                BatchRow &row = rows[f * selected.size() + a];
+                row.instance = files[f];
+                row.algorithm = selected[a];
+                row.n = instance->size();
+                row.expected = expected;
+                row.lowerBound = lowerBound;
+                pool.submit([&, instance, remaining] {
+                    solve(*instance, options.timeLimitSeconds, row);
+                    if (remaining->fetch_sub(1) == 1) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        inFlight--;
+                        instanceDone.notify_all();
+                    }
+                });
+            }
+        }
+        pool.wait();
+    }
+
+    // Wiersze instancji, których nie udało się wczytać, nie trafiają do wyników
+    std::vector<BatchRow> written;
+    bool ok = true;
+    for (size_t f = 0; f < files.size(); f++) {
+        ok = ok && loaded[f];
+        for (size_t a = 0; loaded[f] && a < selected.size(); a++) {
+            const BatchRow &row = rows[f * selected.size() + a];
+            ok = ok && (row.status == "ok" || row.status == "timeout" || row.status == "skipped");
+            written.push_back(row);
+        }
+    }
+    writeRows(written, options.format, out);
+    return ok ? 0 : 1;
+}
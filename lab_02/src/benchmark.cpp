@@ -0,0 +1,43 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <numeric>
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * @brief Wyznacza statystyki próbek (próbki są sortowane w miejscu).
+ *
+ * @param samples Czasy kolejnych przebiegów w sekundach.
+ * @return Statystyki; dla pustego wektora same zera.
+ */
+BenchmarkStats summarizeSamples(std::vector<double> &samples) {
+    BenchmarkStats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const size_t count = samples.size();
+    stats.runs = static_cast<int>(count);
+    stats.min = samples.front();
+    stats.median = count % 2 ? samples[count / 2] : (samples[count / 2 - 1] + samples[count / 2]) / 2;
+    stats.p99 = samples[std::min(count - 1, static_cast<size_t>(0.99 * static_cast<double>(count)))];
+    stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(count);
+    return stats;
+}
+
+/**
+ * @brief Przypina bieżący wątek do jednego procesora (ogranicza szum od migracji między rdzeniami).
+ *
+ * @param cpu Numer procesora.
+ * @return true, jeśli system przyjął ustawienie.
+ */
+bool pinCurrentThread(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
@@ -0,0 +1,189 @@
+#include "cmax_eval.h"
+#include <algorithm>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CMAX_EVAL_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief Oblicza Cmax dla zadanej permutacji.
+ *
+ * @param instance Instancja problemu.
+ * @param order Kolejność wykonania - instance.size() indeksów zadań.
+ * @return Maksymalny czas zakończenia (Cmax).
+ */
+int evaluateCmax(const Instance &instance, const int *order) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    int currentTime = 0, Cmax = 0;
+    for (int k = 0; k < instance.size(); k++) {
+        const int j = order[k];
+        // Jeśli zadanie nie jest jeszcze dostępne, czekamy
+        currentTime = std::max(currentTime, r[j]) + p[j];
+        Cmax = std::max(Cmax, currentTime + q[j]);
+    }
+    return Cmax;
+}
+
+namespace {
+
+void batchScalar(const Instance &instance, const int *permutations, int n, int first, int count, int *results) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    for (int c = first; c < count; c++) {
+        const int *perm = permutations + static_cast<size_t>(c) * n;
+        int currentTime = 0, Cmax = 0;
+        for (int k = 0; k < n; k++) {
+            const int j = perm[k];
+            currentTime = std::max(currentTime, r[j]) + p[j];
+            Cmax = std::max(Cmax, currentTime + q[j]);
+        }
+        results[c] = Cmax;
+    }
+}
+
+#ifdef CMAX_EVAL_X86
+
+/**
+ * @brief Wariant AVX2 - każdy z 8 pasów rejestru liczy Cmax innego kandydata.
+ * Indeksy zadań i wartości r/p/q są pobierane instrukcjami gather.
+ */
+__attribute__((target("avx2")))
+int batchAVX2(const Instance &instance, const int *permutations, int n, int count, int *results) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i stride = _mm256_mullo_epi32(lane, _mm256_set1_epi32(n));
+
+    int c = 0;
+    for (; c + 8 <= count; c += 8) {
+        const int *base = permutations + static_cast<size_t>(c) * n;
+        __m256i time = _mm256_setzero_si256();
+        __m256i Cmax = _mm256_setzero_si256();
+        for (int k = 0; k < n; k++) {
+            __m256i j = _mm256_i32gather_epi32(base + k, stride, 4);
+            __m256i rj = _mm256_i32gather_epi32(r, j, 4);
+            __m256i pj = _mm256_i32gather_epi32(p, j, 4);
+            __m256i qj = _mm256_i32gather_epi32(q, j, 4);
+            time = _mm256_add_epi32(_mm256_max_epi32(time, rj), pj);
+            Cmax = _mm256_max_epi32(Cmax, _mm256_add_epi32(time, qj));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(results + c), Cmax);
+    }
+    return c;
+}
+
+// Nagłówki GCC 12 używają _mm512_undefined_epi32(), co daje fałszywe ostrzeżenia -Wmaybe-uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+/**
+ * @brief Wariant AVX-512 - 16 kandydatów naraz.
+ */
+__attribute__((target("avx512f")))
+int batchAVX512(const Instance &instance, const int *permutations, int n, int count, int *results) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    const __m512i lane = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m512i stride = _mm512_mullo_epi32(lane, _mm512_set1_epi32(n));
+
+    int c = 0;
+    for (; c + 16 <= count; c += 16) {
+        const int *base = permutations + static_cast<size_t>(c) * n;
+        __m512i time = _mm512_setzero_si512();
+        __m512i Cmax = _mm512_setzero_si512();
+        for (int k = 0; k < n; k++) {
+            __m512i j = _mm512_i32gather_epi32(stride, base + k, 4);
+            __m512i rj = _mm512_i32gather_epi32(j, r, 4);
+            __m512i pj = _mm512_i32gather_epi32(j, p, 4);
+            __m512i qj = _mm512_i32gather_epi32(j, q, 4);
+            time = _mm512_add_epi32(_mm512_max_epi32(time, rj), pj);
+            Cmax = _mm512_max_epi32(Cmax, _mm512_add_epi32(time, qj));
+        }
+        _mm512_storeu_si512(results + c, Cmax);
+    }
+    return c;
+}
+
+#pragma GCC diagnostic pop
+
+#endif
+
+} // namespace
+
+/**
+ * @brief Sprawdza, czy dany wariant obliczeń może działać na bieżącym procesorze.
+ *
+ * @param kernel Wariant obliczeń.
+ * @return true jeśli wariant jest dostępny.
+ */
+bool batchKernelSupported(BatchKernel kernel) {
+    switch (kernel) {
+        case BatchKernel::Auto:
+        case BatchKernel::Scalar:
+            return true;
+#ifdef CMAX_EVAL_X86
+        case BatchKernel::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case BatchKernel::AVX512:
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Zwraca nazwę wariantu obliczeń (do raportów benchmarków).
+ *
+ * @param kernel Wariant obliczeń.
+ * @return Nazwa wariantu.
+ */
+const char *batchKernelName(BatchKernel kernel) {
+    switch (kernel) {
+        case BatchKernel::Auto:
+            return "auto";
+        case BatchKernel::Scalar:
+            return "skalarny";
+        case BatchKernel::AVX2:
+            return "AVX2";
+        case BatchKernel::AVX512:
+            return "AVX-512";
+    }
+    return "?";
+}
+
+/**
+ * @brief Oblicza Cmax dla wielu permutacji naraz.
+ *
+ * Permutacje są zapisane jedna po drugiej: zadanie na pozycji k kandydata c to permutations[c * n + k].
+ * Warianty wektorowe liczą po jednym kandydacie na pas rejestru; kandydaci, którzy nie wypełniają
+ * pełnego rejestru, są liczeni pętlą skalarną.
+ *
+ * @param instance Instancja problemu.
+ * @param permutations Permutacje kandydatów (count * n indeksów zadań, n = instance.size()).
+ * @param count Liczba kandydatów.
+ * @param results Tablica wyjściowa na count wartości Cmax.
+ * @param kernel Wymuszony wariant obliczeń; niedostępny wariant zostaje zastąpiony skalarnym.
+ * @return Wariant, który został faktycznie użyty.
+ */
+BatchKernel evaluateCmaxBatch(const Instance &instance, const int *permutations, int count,
+                              int *results, BatchKernel kernel) {
+    const int n = instance.size();
+    if (kernel == BatchKernel::Auto) {
+        kernel = batchKernelSupported(BatchKernel::AVX512) ? BatchKernel::AVX512
+                 : batchKernelSupported(BatchKernel::AVX2) ? BatchKernel::AVX2
+                 : BatchKernel::Scalar;
+    } else if (!batchKernelSupported(kernel)) {
+        kernel = BatchKernel::Scalar;
+    }
+
+    int done = 0;
+#ifdef CMAX_EVAL_X86
+    if (kernel == BatchKernel::AVX512) {
+        done = batchAVX512(instance, permutations, n, count, results);
+    } else if (kernel == BatchKernel::AVX2) {
+        done = batchAVX2(instance, permutations, n, count, results);
+    }
+#endif
+    batchScalar(instance, permutations, n, done, count, results);
+    return kernel;
+}
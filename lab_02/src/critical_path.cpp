@@ -0,0 +1,121 @@
+#include "critical_path.h"
+#include <algorithm>
+#include <climits>
+
+namespace {
+
+/**
+ * @brief Uzupełnia zadanie interferencyjne c i parametry bloku K = (c, b] dla znanych a i b.
+ */
+void findInterference(const Instance &instance, const int *order, CriticalPath &path) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    const int qb = q[order[path.b]];
+    for (int i = path.b - 1; i >= path.a; i--) {
+        if (q[order[i]] < qb) {
+            path.c = i;
+            break;
+        }
+    }
+    if (path.c == -1) {
+        return;
+    }
+
+    path.rK = INT_MAX;
+    path.qK = INT_MAX;
+    for (int i = path.c + 1; i <= path.b; i++) {
+        const int j = order[i];
+        path.rK = std::min(path.rK, r[j]);
+        path.qK = std::min(path.qK, q[j]);
+        path.pK += p[j];
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Analiza harmonogramu permutacji w czasie O(n), bez alokacji pamięci.
+ *
+ * Jeden przebieg w przód wyznacza momenty rozpoczęcia, Cmax, ostatnie zadanie b realizujące Cmax
+ * i początek a jego bloku (ostatni przestój przed b). Zadanie interferencyjne c i parametry bloku
+ * K szukane są tylko w obrębie a..b. Opcjonalnie wypełniane są tablice wywołującego:
+ * head[k] - moment rozpoczęcia zadania z pozycji k (najdłuższa droga do niego),
+ * tail[k] - najdłuższa droga od rozpoczęcia następnika do końca, z q tego zadania włącznie:
+ * tail[k] = max(q, p[k+1] + tail[k+1]). Dla każdej pozycji head + p + tail <= Cmax, z równością
+ * na ścieżce krytycznej.
+ *
+ * @param instance Instancja problemu.
+ * @param order Permutacja (instance.size() indeksów zadań).
+ * @param head Tablica n elementów na momenty rozpoczęcia albo nullptr.
+ * @param tail Tablica n elementów na ogony albo nullptr.
+ * @return Cmax, blok krytyczny a..b, zadanie interferencyjne c i parametry bloku K.
+ */
+CriticalPath analyzeSchedule(const Instance &instance, const int *order, int *head, int *tail) {
+    const int n = instance.size();
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    CriticalPath path;
+    if (n == 0) {
+        return path;
+    }
+
+    int time = 0;
+    int blockStart = 0;
+    for (int k = 0; k < n; k++) {
+        const int j = order[k];
+        // Przestój przed zadaniem zaczyna nowy blok
+        if (r[j] > time) {
+            time = r[j];
+            blockStart = k;
+        }
+        if (head) {
+            head[k] = time;
+        }
+        time += p[j];
+        if (time + q[j] >= path.Cmax) {
+            path.Cmax = time + q[j];
+            path.b = k;
+            path.a = blockStart;
+        }
+    }
+    findInterference(instance, order, path);
+
+    if (tail) {
+        tail[n - 1] = q[order[n - 1]];
+        for (int k = n - 2; k >= 0; k--) {
+            tail[k] = std::max(q[order[k]], p[order[k + 1]] + tail[k + 1]);
+        }
+    }
+    return path;
+}
+
+/**
+ * @brief Blok krytyczny dla znanych momentów zakończenia (np. utrzymywanych przyrostowo).
+ *
+ * Koszt jest proporcjonalny do odległości b od końca permutacji i długości bloku, a nie do n.
+ *
+ * @param instance Instancja problemu.
+ * @param order Permutacja (instance.size() indeksów zadań).
+ * @param completion completion[k] - moment zakończenia zadania z pozycji k.
+ * @param Cmax Cmax permutacji.
+ * @return Blok krytyczny a..b, zadanie interferencyjne c i parametry bloku K.
+ */
+CriticalPath criticalBlock(const Instance &instance, const int *order, const int *completion, int Cmax) {
+    const int *r = instance.r(), *q = instance.q();
+    CriticalPath path;
+    path.Cmax = Cmax;
+    if (instance.size() == 0) {
+        return path;
+    }
+
+    int b = instance.size() - 1;
+    while (b > 0 && completion[b] + q[order[b]] != Cmax) {
+        b--;
+    }
+    int a = b;
+    while (a > 0 && completion[a - 1] >= r[order[a]]) {
+        a--;
+    }
+    path.a = a;
+    path.b = b;
+    findInterference(instance, order, path);
+    return path;
+}
@@ -0,0 +1,41 @@
+#include "instance.h"
+
+Instance::Instance(const std::vector<task> &tasks) : n(static_cast<int>(tasks.size())) {
+    std::shared_ptr<int[]> columns(new int[3 * tasks.size()]);
+    int *r = columns.get();
+    int *p = r + n;
+    int *q = p + n;
+    for (int i = 0; i < n; i++) {
+        r[i] = tasks[i].r;
+        p[i] = tasks[i].p;
+        q[i] = tasks[i].q;
+    }
+
+    rData = r;
+    pData = p;
+    qData = q;
+    storage = std::move(columns);
+}
+
+Instance Instance::borrow(int n, const int *r, const int *p, const int *q) {
+    Instance instance;
+    instance.n = n;
+    instance.rData = r;
+    instance.pData = p;
+    instance.qData = q;
+    return instance;
+}
+
+Instance Instance::adopt(int n, const int *r, const int *p, const int *q, std::shared_ptr<const void> owner) {
+    Instance instance = borrow(n, r, p, q);
+    instance.storage = std::move(owner);
+    return instance;
+}
+
+std::vector<task> Instance::toTasks() const {
+    std::vector<task> tasks(n);
+    for (int i = 0; i < n; i++) {
+        tasks[i] = {i + 1, rData[i], pData[i], qData[i]};
+    }
+    return tasks;
+}
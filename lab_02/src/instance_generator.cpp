@@ -0,0 +1,242 @@
+#include "instance_generator.h"
+#include <algorithm>
+#include <charconv>
+#include <climits>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "binary_instance.h"
+#include "split_mix.h"
+#include "thread_pool.h"
+
+namespace {
+
+constexpr long CHUNK = 1L << 16;  ///< Zadań w jednym zadaniu puli
+constexpr long BATCH = 1L << 22;  ///< Zadań generowanych przed zapisem (kolumny i tekst mieszczą się w ~200 MB)
+
+/**
+ * @brief Liczba z przedziału [low, high] z 32 starszych bitów (mnożenie zamiast dzielenia modulo)
+ */
+inline int uniform(uint64_t bits, int low, int high) {
+    return low + static_cast<int>(((bits >> 32) * (static_cast<uint64_t>(high) - low + 1)) >> 32);
+}
+
+/**
+ * @brief Sprawdza parametry generatora, w tym to, czy Cmax każdej permutacji mieści się w int
+ * @return Opis błędu; pusty, jeśli parametry są poprawne
+ */
+std::string validate(const GeneratorOptions &options) {
+    if (options.n < 1 || options.n > INT_MAX) {
+        return "Liczba zadań musi należeć do [1, " + std::to_string(INT_MAX) + "]";
+    }
+    if (options.pMin < 1 || options.pMax < options.pMin) {
+        return "Niepoprawny zakres czasów przetwarzania";
+    }
+    if (options.correlation < 0 || options.correlation > 1) {
+        return "Współczynnik korelacji musi należeć do [0, 1]";
+    }
+
+    // Algorytmy przechowują r, p, q i Cmax w int: największy możliwy Cmax to r + suma p + q, a r i q nie przekraczają W
+    const int64_t W = releaseWindow(options);
+    const int64_t worstCmax = options.n * static_cast<int64_t>(options.pMax) + 2 * W;
+    if (worstCmax > INT_MAX) {
+        return "Cmax instancji może przekroczyć zakres int (n * pMax + 2W = " + std::to_string(worstCmax) +
+               ") - zmniejsz --n, --p-max lub --window";
+    }
+    return "";
+}
+
+/**
+ * @brief Generuje zadania [first, first + count) równolegle, w kawałkach po CHUNK zadań.
+ *
+ * Po wygenerowaniu kawałka wywoływane jest after(kawałek, początek, liczba) - w tym samym wątku.
+ */
+template<typename After>
+void generateParallel(ThreadPool &pool, const GeneratorOptions &options, long first, long count,
+                      int *r, int *p, int *q, After after) {
+    for (long offset = 0, chunk = 0; offset < count; offset += CHUNK, chunk++) {
+        pool.submit([=, &options, &after] {
+            const long size = std::min(CHUNK, count - offset);
+            generateTasks(options, first + offset, size, r + offset, p + offset, q + offset);
+            after(chunk, offset, size);
+        });
+    }
+    pool.wait();
+}
+
+/**
+ * @brief Zapisuje n zadań w formacie .dat; wiersze formatowane są równolegle, zapis jest sekwencyjny.
+ */
+void writeText(const GeneratorOptions &options, ThreadPool &pool, std::ofstream &file) {
+    const long batch = std::min(BATCH, options.n);
+    std::vector<int> r(batch), p(batch), q(batch);
+    std::vector<std::string> lines((batch + CHUNK - 1) / CHUNK);
+
+    file << options.n << '\n';
+    for (long first = 0; first < options.n; first += batch) {
+        const long count = std::min(batch, options.n - first);
+        generateParallel(pool, options, first, count, r.data(), p.data(), q.data(),
+                         [&](long chunk, long offset, long size) {
+                             // Wiersz to najwyżej trzy liczby int, dwie spacje i znak nowej linii
+                             std::string &text = lines[chunk];
+                             text.resize(size * 36);
+                             char *out = text.data(), *end = text.data() + text.size();
+                             for (long k = offset; k < offset + size; k++) {
+                                 out = std::to_chars(out, end, r[k]).ptr;
+                                 *out++ = ' ';
+                                 out = std::to_chars(out, end, p[k]).ptr;
+                                 *out++ = ' ';
+                                 out = std::to_chars(out, end, q[k]).ptr;
+                                 *out++ = '\n';
+                             }
+                             text.resize(out - text.data());
+                         });
+        for (long chunk = 0; chunk * CHUNK < count; chunk++) {
+            file.write(lines[chunk].data(), static_cast<std::streamsize>(lines[chunk].size()));
+        }
+    }
+}
+
+/**
+ * @brief Zapisuje n zadań w formacie binarnym; każda porcja trafia od razu na swoje miejsce w trzech kolumnach.
+ */
+void writeBinary(const GeneratorOptions &options, ThreadPool &pool, std::ofstream &file) {
+    const BinaryInstanceHeader header = makeBinaryHeader(BinaryInstanceKind::RPQ, static_cast<uint32_t>(options.n), 3);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    const long batch = std::min(BATCH, options.n);
+    std::vector<int> r(batch), p(batch), q(batch);
+    const int *columns[] = {r.data(), p.data(), q.data()};
+    for (long first = 0; first < options.n; first += batch) {
+        const long count = std::min(batch, options.n - first);
+        generateParallel(pool, options, first, count, r.data(), p.data(), q.data(), [](long, long, long) {});
+        for (uint32_t c = 0; c < 3; c++) {
+            file.seekp(static_cast<std::streamoff>(header.columnOffset + c * header.columnStride + first * sizeof(int32_t)));
+            file.write(reinterpret_cast<const char *>(columns[c]), static_cast<std::streamsize>(count * sizeof(int32_t)));
+        }
+    }
+
+    // Dopełnienie kolumn do wyrównania (ostatnia kolumna wyznacza rozmiar pliku)
+    static const char padding[BINARY_INSTANCE_ALIGNMENT] = {};
+    const uint64_t bytes = static_cast<uint64_t>(options.n) * sizeof(int32_t);
+    for (uint32_t c = 0; c < 3; c++) {
+        file.seekp(static_cast<std::streamoff>(header.columnOffset + c * header.columnStride + bytes));
+        file.write(padding, static_cast<std::streamsize>(header.columnStride - bytes));
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Zwraca szerokość okna W, z którego losowane są r i q.
+ *
+ * @param options Parametry generatora.
+ * @return W = window * n * (pMin + pMax) / 2, ograniczone do [1, INT_MAX / 2].
+ */
+int releaseWindow(const GeneratorOptions &options) {
+    const double window = options.window >= 0 ? options.window
+                                              : options.distribution == TaskDistribution::Tight ? 0.7 : 1.0;
+    const double W = window * static_cast<double>(options.n) * (options.pMin + options.pMax) / 2;
+    return static_cast<int>(std::clamp(W, 1.0, static_cast<double>(INT_MAX / 2)));
+}
+
+/**
+ * @brief Generuje zadania first..first+count-1 instancji opisanej przez options.
+ *
+ * Zadanie j zależy tylko od ziarna i j (kolejne wartości splitmix64 od pozycji 3j), więc wynik
+ * nie zależy od podziału na porcje i wątki ani od implementacji biblioteki standardowej.
+ * W rozkładzie Tight zadanie dostaje środek c z [1, W]; r leży najwyżej pMax przed c, a q najwyżej
+ * pMax przed W - c, więc r + q jest bliskie W dla każdego zadania: zadanie ma wąskie okno wykonania
+ * wokół c, a nie niezależne r i q jak w Uniform.
+ *
+ * @param options Parametry generatora.
+ * @param first Indeks pierwszego zadania.
+ * @param count Liczba zadań.
+ * @param r Otrzymuje czasy dostępności (count elementów).
+ * @param p Otrzymuje czasy przetwarzania.
+ * @param q Otrzymuje czasy dostarczenia.
+ */
+void generateTasks(const GeneratorOptions &options, long first, long count, int *r, int *p, int *q) {
+    const int W = releaseWindow(options);
+    const uint64_t state = splitMix64(options.seed);
+    // Correlated: share okna wyznacza p (liniowo od pMin do pMax), reszta jest losowa
+    const int share = options.distribution == TaskDistribution::Correlated ?
+                      static_cast<int>(options.correlation * W) : 0;
+    const int span = std::max(W - share, 1);
+    const int pRange = std::max(options.pMax - options.pMin, 1);
+
+    for (long k = 0; k < count; k++) {
+        const uint64_t position = (static_cast<uint64_t>(first + k) * 3 + 1) * SPLIT_MIX_GAMMA + state;
+        p[k] = uniform(splitMix64(position), options.pMin, options.pMax);
+        if (options.distribution == TaskDistribution::Tight) {
+            const int centre = uniform(splitMix64(position + SPLIT_MIX_GAMMA), 1, W);
+            // Odchylenia r i q z jednej wartości: starsze i młodsze 32 bity
+            const uint64_t bits = splitMix64(position + 2 * SPLIT_MIX_GAMMA);
+            r[k] = std::max(1, centre - uniform(bits, 0, options.pMax));
+            q[k] = std::max(1, W - centre + 1 - uniform(bits << 32, 0, options.pMax));
+            continue;
+        }
+        const int base = static_cast<int>(static_cast<int64_t>(share) * (p[k] - options.pMin) / pRange);
+        r[k] = base + uniform(splitMix64(position + SPLIT_MIX_GAMMA), 1, span);
+        q[k] = base + uniform(splitMix64(position + 2 * SPLIT_MIX_GAMMA), 1, span);
+    }
+}
+
+/**
+ * @brief Generuje całą instancję w pamięci (równolegle).
+ *
+ * @param options Parametry generatora.
+ * @return Instancja z kolumnami we wspólnym buforze albo opis błędu parametrów (jak w writeGeneratedInstance).
+ */
+LoadResult generateInstance(const GeneratorOptions &options) {
+    LoadResult result;
+    result.error = validate(options);
+    if (!result) {
+        return result;
+    }
+
+    const int n = static_cast<int>(options.n);
+    std::shared_ptr<int[]> columns(new int[3 * static_cast<size_t>(n)]);
+    int *r = columns.get(), *p = r + n, *q = p + n;
+
+    ThreadPool pool(options.threadCount);
+    generateParallel(pool, options, 0, n, r, p, q, [](long, long, long) {});
+    result.instance = Instance::adopt(n, r, p, q, columns);
+    return result;
+}
+
+/**
+ * @brief Generuje instancję i zapisuje ją strumieniowo, porcjami po 2^22 zadań.
+ *
+ * Porcja jest generowana (i w formacie tekstowym formatowana) równolegle w puli wątków,
+ * a następnie zapisywana, więc zużycie pamięci nie zależy od n. Ten sam zestaw parametrów
+ * daje identyczny plik niezależnie od liczby wątków.
+ *
+ * @param options Parametry generatora.
+ * @param path Ścieżka pliku wynikowego.
+ * @param format Format tekstowy .dat albo binarny.
+ * @return Opis błędu; pusty, jeśli zapis się powiódł.
+ */
+std::string writeGeneratedInstance(const GeneratorOptions &options, const std::string &path, InstanceFormat format) {
+    std::string error = validate(options);
+    if (!error.empty()) {
+        return error;
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return "Nie można utworzyć pliku: " + path;
+    }
+
+    ThreadPool pool(options.threadCount);
+    if (format == InstanceFormat::Binary) {
+        writeBinary(options, pool, file);
+    } else {
+        writeText(options, pool, file);
+    }
+    if (!file.flush()) {
+        return "Błąd zapisu pliku: " + path;
+    }
+    return "";
+}
@@ -0,0 +1,165 @@
+#include "instance_io.h"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <memory>
+#include "binary_instance.h"
+#include "mapped_file.h"
+
+namespace {
+
+/**
+ * @brief Pomija białe znaki (spacje, tabulatory, końce wierszy w stylu Unix i Windows).
+ */
+inline const char *skipSpace(const char *cursor, const char *end) {
+    while (cursor < end && (*cursor == ' ' || *cursor == '\n' || *cursor == '\r' || *cursor == '\t')) {
+        cursor++;
+    }
+    return cursor;
+}
+
+/**
+ * @brief Czyta jedną liczbę całkowitą; po liczbie musi wystąpić biały znak albo koniec danych.
+ * @return false, jeśli w tym miejscu nie ma poprawnej liczby
+ */
+inline bool readInt(const char *&cursor, const char *end, int &value) {
+    cursor = skipSpace(cursor, end);
+    auto [next, errc] = std::from_chars(cursor, end, value);
+    if (errc != std::errc() || (next < end && *next != ' ' && *next != '\n' && *next != '\r' && *next != '\t')) {
+        return false;
+    }
+    cursor = next;
+    return true;
+}
+
+} // namespace
+
+/**
+ * @brief Parsuje instancję w formacie SCHRAGE*.dat (n, a potem n wierszy "r p q") prosto do kolumn.
+ *
+ * Liczby czytane są funkcją std::from_chars bez kopiowania tekstu; wynik trafia do jednego bufora
+ * z kolumnami r, p, q, który staje się właścicielem danych instancji. Tak jak dawniej przy
+ * std::ifstream, dane po n-tym zadaniu są ignorowane. Ujemne r, p lub q są odrzucane - algorytmy
+ * sortują zadania po kluczach bez znaku.
+ *
+ * @param begin Początek tekstu.
+ * @param end Koniec tekstu.
+ * @return Instancja albo opis pierwszego napotkanego błędu.
+ */
+LoadResult parseInstance(const char *begin, const char *end) {
+    LoadResult result;
+    const char *cursor = begin;
+
+    int n = 0;
+    if (!readInt(cursor, end, n) || n < 0) {
+        result.error = "Niepoprawna liczba zadań w nagłówku";
+        return result;
+    }
+
+    // Każde zadanie to co najmniej "r p q" oddzielone pojedynczymi znakami - tani test przed alokacją
+    if (static_cast<size_t>(n) > static_cast<size_t>(end - cursor + 1) / 6) {
+        result.error = "Plik jest za krótki dla " + std::to_string(n) + " zadań";
+        return result;
+    }
+
+    std::shared_ptr<int[]> columns(new int[3 * static_cast<size_t>(n)]);
+    int *r = columns.get();
+    int *p = r + n;
+    int *q = p + n;
+    for (int i = 0; i < n; i++) {
+        if (!readInt(cursor, end, r[i]) || !readInt(cursor, end, p[i]) || !readInt(cursor, end, q[i])) {
+            result.error = "Niepoprawne dane zadania " + std::to_string(i + 1) + " z " + std::to_string(n);
+            return result;
+        }
+        if (r[i] < 0 || p[i] < 0 || q[i] < 0) {
+            result.error = "Ujemne dane zadania " + std::to_string(i + 1) + " z " + std::to_string(n);
+            return result;
+        }
+    }
+
+    result.instance = Instance::adopt(n, r, p, q, std::move(columns));
+    return result;
+}
+
+/**
+ * @brief Wczytuje instancję z pliku odwzorowanego w pamięci.
+ *
+ * Plik w formacie binarnym (binary_instance.h) jest używany bez kopiowania: kolumny instancji
+ * wskazują wprost na odwzorowanie, które żyje tak długo jak instancja (kolumny są tylko
+ * przeglądane w poszukiwaniu ujemnych wartości). Plik tekstowy .dat jest parsowany funkcją parseInstance.
+ *
+ * @param path Pełna ścieżka do pliku (bez dopisywanego katalogu).
+ * @return Instancja albo opis błędu (brak pliku, niepoprawny format).
+ */
+LoadResult loadInstance(const std::string &path) {
+    LoadResult result;
+    std::shared_ptr<const MappedFile> file = MappedFile::open(path, result.error);
+    if (!file) {
+        return result;
+    }
+
+    if (isBinaryInstance(file->data(), file->size())) {
+        const BinaryInstanceHeader *header = readBinaryHeader(file->data(), file->size(), BinaryInstanceKind::RPQ,
+                                                              result.error);
+        if (header && (header->columns != 3 || header->jobs > INT32_MAX)) {
+            result.error = "Instancja 1|r,q|Cmax musi mieć 3 kolumny";
+        }
+        for (uint32_t c = 0; header && result && c < 3; c++) {
+            const int32_t *column = binaryColumn(file->data(), *header, c);
+            if (std::any_of(column, column + header->jobs, [](int32_t value) { return value < 0; })) {
+                result.error = "Ujemne dane w kolumnie " + std::to_string(c + 1);
+            }
+        }
+        if (!result) {
+            result.error = path + ": " + result.error;
+            return result;
+        }
+        result.instance = Instance::adopt(static_cast<int>(header->jobs), binaryColumn(file->data(), *header, 0),
+                                          binaryColumn(file->data(), *header, 1),
+                                          binaryColumn(file->data(), *header, 2), file);
+        return result;
+    }
+
+    result = parseInstance(file->data(), file->data() + file->size());
+    if (!result) {
+        result.error = path + ": " + result.error;
+    }
+    return result;
+}
+
+/**
+ * @brief Wczytuje wartość wzorcową Cmax z pliku .out (pierwsza liczba w pliku).
+ *
+ * @param path Pełna ścieżka do pliku (bez dopisywanego katalogu).
+ * @return Wartość albo opis błędu (brak pliku, brak nieujemnej liczby na początku pliku).
+ */
+OutcomeResult readCorrectOutcome(const std::string &path) {
+    OutcomeResult result;
+    std::shared_ptr<const MappedFile> file = MappedFile::open(path, result.error);
+    if (!file) {
+        return result;
+    }
+
+    const char *cursor = file->data();
+    int value = 0;
+    if (!readInt(cursor, file->data() + file->size(), value) || value < 0) {
+        result.error = path + ": niepoprawna wartość wzorcowa";
+        return result;
+    }
+    result.value = value;
+    return result;
+}
+
+/**
+ * @brief Zapisuje instancję w formacie binarnym (kolumny r, p, q).
+ *
+ * @param instance Instancja do zapisania.
+ * @param path Ścieżka pliku wynikowego.
+ * @return Opis błędu; pusty, jeśli zapis się powiódł.
+ */
+std::string saveBinaryInstance(const Instance &instance, const std::string &path) {
+    std::string error;
+    writeBinaryInstance(path, BinaryInstanceKind::RPQ, static_cast<uint32_t>(instance.size()),
+                        {instance.r(), instance.p(), instance.q()}, error);
+    return error;
+}
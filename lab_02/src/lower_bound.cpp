@@ -0,0 +1,184 @@
+#include "lower_bound.h"
+#include <climits>
+#include <cstdint>
+#include "alg_01_schrage.h"
+
+namespace {
+
+/// Przesunięcie liści jeszcze niewstawionych zadań - żaden z nich nie może wyznaczać maksimum
+constexpr int64_t INACTIVE = INT64_C(1) << 50;
+
+/**
+ * @brief Drzewo przedziałowe (nierekurencyjne) z dodawaniem na przedziale i maksimum całego drzewa.
+ *
+ * Liczba liści jest zaokrąglona do potęgi dwójki (nadmiarowe liście mają wartość -INACTIVE).
+ * Dodatek przedziału zapisywany jest w węźle wewnętrznym (add) i wliczany do jego maksimum, więc nie
+ * trzeba go spychać do potomków - po aktualizacji przeliczane są tylko ścieżki do korzenia.
+ */
+struct MaxAddTree {
+    int size;       ///< Liczba liści (potęga dwójki)
+    int64_t *max;   ///< Maksimum poddrzewa (z dodatkami węzła i potomków), węzły 1..2*size-1
+    int64_t *add;   ///< Dodatek obejmujący całe poddrzewo, węzły wewnętrzne 1..size-1
+
+    void apply(int node, int64_t value) {
+        max[node] += value;
+        if (node < size) {
+            add[node] += value;
+        }
+    }
+
+    void pull(int node) {
+        for (node >>= 1; node >= 1; node >>= 1) {
+            max[node] = std::max(max[2 * node], max[2 * node + 1]) + add[node];
+        }
+    }
+
+    /**
+     * @brief Dodaje value do liści from..to-1
+     */
+    void rangeAdd(int from, int to, int64_t value) {
+        int left = from + size, right = to + size;
+        const int first = left, last = right - 1;
+        while (left < right) {
+            if (left & 1) {
+                apply(left++, value);
+            }
+            if (right & 1) {
+                apply(--right, value);
+            }
+            left >>= 1;
+            right >>= 1;
+        }
+        pull(first);
+        pull(last);
+    }
+
+    int64_t top() const { return max[1]; }
+};
+
+} // namespace
+
+/**
+ * @brief Ograniczenie pojedynczego zadania: żadne zadanie nie skończy się przed r_j + p_j + q_j.
+ *
+ * @param instance Instancja problemu.
+ * @return max po zadaniach r_j + p_j + q_j (0 dla pustej instancji).
+ */
+int singleJobBound(const Instance &instance) {
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+    int bound = 0;
+    for (int j = 0; j < instance.size(); j++) {
+        bound = std::max(bound, r[j] + p[j] + q[j]);
+    }
+    return bound;
+}
+
+/**
+ * @brief Ograniczenie blokowe h(K) = min r + suma p + min q maksymalizowane po wszystkich zbiorach K.
+ *
+ * Dla progów r0 i q0 najlepszym zbiorem jest {j : r_j >= r0, q_j >= q0}, więc wystarczy przejrzeć
+ * pary progów. Zadania wstawiane są malejąco po r; drzewo przedziałowe nad zadaniami posortowanymi
+ * po q trzyma dla każdego progu q0 wartość q0 + suma p wstawionych zadań z q >= q0. Wstawienie zadania
+ * to dodanie p na prefiksie progów i aktywacja jego liścia, a po wstawieniu wszystkich zadań o danym r
+ * r0 + maksimum drzewa jest kandydatem na wynik. Całość działa w czasie O(n log n).
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @return max po niepustych K wartości h(K) (0 dla pustej instancji).
+ */
+int blockSweepBound(const Instance &instance, ScratchArena &arena) {
+    ScratchArena::Scope scope(arena);
+    const int n = instance.size();
+    if (n == 0) {
+        return 0;
+    }
+    const int *r = instance.r(), *p = instance.p(), *q = instance.q();
+
+    // Kolejność wstawiania (malejąco po r) i kolejność liści (rosnąco po q); indeks w młodszych bitach
+    uint64_t *byR = arena.allocate<uint64_t>(n);
+    uint64_t *byQ = arena.allocate<uint64_t>(n);
+    for (int j = 0; j < n; j++) {
+        byR[j] = (static_cast<uint64_t>(static_cast<uint32_t>(r[j])) << 32) | static_cast<uint32_t>(j);
+        byQ[j] = (static_cast<uint64_t>(static_cast<uint32_t>(q[j])) << 32) | static_cast<uint32_t>(j);
+    }
+    std::sort(byR, byR + n);
+    std::sort(byQ, byQ + n);
+
+    // leaf[j] - liść zadania j; prefixEnd[i] - ostatni liść z tym samym q co liść i
+    int *leaf = arena.allocate<int>(n);
+    int *prefixEnd = arena.allocate<int>(n);
+    int size = 1;
+    while (size < n) {
+        size *= 2;
+    }
+    MaxAddTree tree{size, arena.allocate<int64_t>(2 * static_cast<size_t>(size)),
+                    arena.allocate<int64_t>(size)};
+    std::fill(tree.max + size + n, tree.max + 2 * size, -INACTIVE);
+    for (int i = n - 1; i >= 0; i--) {
+        leaf[static_cast<uint32_t>(byQ[i])] = i;
+        prefixEnd[i] = i + 1 < n && (byQ[i + 1] >> 32) == (byQ[i] >> 32) ? prefixEnd[i + 1] : i;
+        tree.max[size + i] = static_cast<int64_t>(byQ[i] >> 32) - INACTIVE;
+    }
+    std::fill(tree.add, tree.add + size, 0);
+    for (int node = size - 1; node >= 1; node--) {
+        tree.max[node] = std::max(tree.max[2 * node], tree.max[2 * node + 1]);
+    }
+
+    int64_t bound = 0;
+    for (int k = n - 1; k >= 0; k--) {
+        const int j = static_cast<int>(static_cast<uint32_t>(byR[k]));
+        const int i = leaf[j];
+        tree.rangeAdd(0, prefixEnd[i] + 1, p[j]);
+        tree.rangeAdd(i, i + 1, INACTIVE);
+
+        // Kandydat dopiero po wstawieniu wszystkich zadań o tym samym r
+        if (k == 0 || (byR[k - 1] >> 32) != (byR[k] >> 32)) {
+            bound = std::max(bound, r[j] + tree.top());
+        }
+    }
+    return static_cast<int>(bound);
+}
+
+/**
+ * @brief Ograniczenie blokowe dla ścieżki krytycznej konkretnej permutacji (używane w węzłach Carliera).
+ *
+ * @param instance Instancja problemu (np. dane węzła ze zmodyfikowanymi r/q).
+ * @param order Permutacja, dla której wyznaczono path.
+ * @param path Ścieżka krytyczna z analyzeSchedule/criticalBlock.
+ * @return max(h(K), h(K + c)) dla bloku K = (c, b]; 0, jeśli nie ma zadania interferencyjnego.
+ */
+int criticalBlockBound(const Instance &instance, const int *order, const CriticalPath &path) {
+    if (path.c == -1) {
+        return 0;
+    }
+    const int c = order[path.c];
+    const int hK = path.rK + path.pK + path.qK;
+    const int hKc = std::min(path.rK, instance.r()[c]) + path.pK + instance.p()[c] + std::min(path.qK, instance.q()[c]);
+    return std::max(hK, hKc);
+}
+
+/**
+ * @brief Wszystkie dolne ograniczenia instancji.
+ *
+ * @param instance Instancja problemu.
+ * @param arena Pamięć robocza.
+ * @return Ograniczenia: z wywłaszczaniem, pojedynczego zadania i blokowe.
+ */
+LowerBounds lowerBounds(const Instance &instance, ScratchArena &arena) {
+    LowerBounds bounds;
+    bounds.preemptive = schragePreemptivePlaning(instance, arena);
+    bounds.singleJob = singleJobBound(instance);
+    bounds.block = blockSweepBound(instance, arena);
+    return bounds;
+}
+
+/**
+ * @brief Odległość wyniku od dolnego ograniczenia w procentach.
+ *
+ * @param Cmax Wartość rozwiązania.
+ * @param lowerBound Dolne ograniczenie.
+ * @return 100 * (Cmax - LB) / LB; 0, gdy LB <= 0. Zero oznacza rozwiązanie optymalne.
+ */
+double optimalityGap(int Cmax, int lowerBound) {
+    return lowerBound > 0 ? 100.0 * (Cmax - lowerBound) / lowerBound : 0.0;
+}
@@ -5,84 +5,150 @@
 #include <fstream>
 #include <vector>
 #include <string>
-#include <chrono>
 #include "alg_03_wspt.h"
+#include "alg_04_carlier.h"
+#include "alg_05_carlier_parallel.h"
+#include "alg_06_bitmask_dp.h"
+#include "alg_07_tabu.h"
+#include "alg_08_portfolio.h"
+#include "alg_09_annealing.h"
+#include "alg_10_genetic.h"
+#include "wspt_tuner.h"
+#include "instance_io.h"
+#include "lower_bound.h"
+#include "batch_runner.h"
+#include "benchmark.h"
+#include <cstring>
+#include <sstream>
+#include <iomanip>
 
 /**
- * @brief Funkcja loadTasksFromFile wczytuje dane z pliku i tworzy wektor zadań.
+ * @brief Funkcja measureExecutionTime mierzy czas wykonania funkcji.
+ *
+ * Funkcja jest uruchamiana wielokrotnie (rozgrzewka i powtórzenia z runBenchmark), a wynikiem
+ * jest mediana czasu; algorytmy trwające dłużej niż budżet pomiaru uruchamiane są raz.
  *
- * @param filename Nazwa pliku, z którego mają być wczytane dane.
- * @return Wektor zadań, gdzie każde zadanie ma pola r (czas dostępności), p (czas przetwarzania) i q (czas zakończenia).
+ * @param func Funkcja do wykonania.
+ * @param instance Instancja przekazywana do funkcji.
+ * @param arena Pamięć robocza przekazywana do funkcji.
+ * @param order Wektor na permutację wynikową.
+ * @return Para zawierająca wynik funkcji oraz medianę czasu jej wykonania w sekundach.
  */
-std::vector<task> loadTasksFromFile(const std::string &filename)
+template <typename Func>
+std::pair<int, double> measureExecutionTime(Func func, const Instance &instance, ScratchArena &arena, std::vector<int> &order)
 {
-    std::ifstream file("data/" + filename);
-    std::vector<task> tasks;
-
-    if (!file)
-    {
-        std::cerr << "Nie można otworzyć pliku: " << filename << std::endl;
-        exit(EXIT_FAILURE);
-    }
+    BenchmarkOptions options;
+    options.budgetSeconds = 0.05;
 
-    int n;
-    file >> n;
-    tasks.resize(n);
-
-    for (int i = 0; i < n; i++)
-    {
-        file >> tasks[i].r >> tasks[i].p >> tasks[i].q;
-        tasks[i].id = i + 1;
-    }
-
-    file.close();
-    return tasks;
+    int result = 0;
+    BenchmarkStats stats = runBenchmark([&] { return result = func(instance, arena, order); }, options);
+    return {result, stats.median};
 }
 
 /**
- * @brief Funkcja readCorrectOutcome wczytuje poprawny wynik z pliku.
+ * @brief Funkcja batchMain obsługuje tryb wsadowy: lab_02 --batch <wejście>... [opcje].
+ *
+ * Opcje: --format csv|json, --threads N, --time-limit sekundy (limit jednego algorytmu na jednej instancji),
+ * --algorithms nazwa1,nazwa2,..., --output plik.
+ * Wejście to katalog, wzorzec glob albo plik instancji.
  *
- * @param fileName Nazwa pliku, z którego ma być wczytany wynik.
- * @return Poprawny wynik jako liczba całkowita.
+ * @param argc Liczba argumentów programu.
+ * @param argv Argumenty programu (argv[1] to --batch).
+ * @return Kod wyjścia programu.
  */
-int readCorrectOutcome(const std::string &fileName)
+int batchMain(int argc, char **argv)
 {
-    std::ifstream inputFile("data/" + fileName);
+    BatchOptions options;
+    std::string output;
 
-    if (!inputFile)
+    for (int i = 2; i < argc; i++)
     {
-        std::cerr << "Nie można otworzyć pliku: " << fileName << std::endl;
-        exit(EXIT_FAILURE);
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--format") == 0 && hasValue)
+        {
+            const std::string format = argv[++i];
+            if (format != "csv" && format != "json")
+            {
+                std::cerr << "Nieznany format: " << format << std::endl;
+                return EXIT_FAILURE;
+            }
+            options.format = format == "json" ? BatchFormat::JSON : BatchFormat::CSV;
+        }
+        else if (std::strcmp(argv[i], "--threads") == 0 && hasValue)
+        {
+            options.threadCount = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--time-limit") == 0 && hasValue)
+        {
+            options.timeLimitSeconds = std::atof(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--algorithms") == 0 && hasValue)
+        {
+            std::stringstream list(argv[++i]);
+            std::string name;
+            while (std::getline(list, name, ','))
+            {
+                options.algorithms.push_back(name);
+            }
+        }
+        else if (std::strcmp(argv[i], "--output") == 0 && hasValue)
+        {
+            output = argv[++i];
+        }
+        else if (std::strncmp(argv[i], "--", 2) == 0)
+        {
+            std::cerr << "Nieznana opcja: " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        else
+        {
+            options.inputs.emplace_back(argv[i]);
+        }
     }
 
-    int number;
-    inputFile >> number;
+    if (options.inputs.empty())
+    {
+        std::cerr << "Użycie: " << argv[0] << " --batch <katalog|wzorzec|plik>... [--format csv|json] "
+                  << "[--threads N] [--time-limit sekundy] [--algorithms nazwa1,nazwa2] [--output plik]" << std::endl;
+        return EXIT_FAILURE;
+    }
 
-    inputFile.close();
+    if (output.empty())
+    {
+        return runBatch(options, std::cout, std::cerr);
+    }
 
-    return number;
+    std::ofstream file(output);
+    if (!file)
+    {
+        std::cerr << "Nie można utworzyć pliku: " << output << std::endl;
+        return EXIT_FAILURE;
+    }
+    return runBatch(options, file, std::cerr);
 }
 
 /**
- * @brief Funkcja measureExecutionTime mierzy czas wykonania funkcji.
+ * @brief Funkcja formatGap opisuje odległość wyniku od dolnego ograniczenia.
  *
- * @param func Funkcja do wykonania.
- * @param tasks Wektor zadań przekazywany do funkcji.
- * @return Para zawierająca wynik funkcji oraz czas jej wykonania w sekundach.
+ * @param Cmax Wynik algorytmu.
+ * @param lowerBound Dolne ograniczenie instancji.
+ * @return Tekst postaci " (LB +1.23%)"; zero oznacza wynik optymalny.
  */
-template <typename Func>
-std::pair<int, double> measureExecutionTime(Func func, std::vector<task> &tasks)
+std::string formatGap(int Cmax, int lowerBound)
 {
-    auto start = std::chrono::high_resolution_clock::now();
-    int result = func(tasks);
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> elapsed = end - start;
-    return {result, elapsed.count()};
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(2) << " (LB +" << optimalityGap(Cmax, lowerBound) << "%)";
+    return text.str();
 }
 
 // ctr; + shift + i <--- code format
-int main()
+int main(int argc, char **argv)
 {
+    if (argc > 1 && std::strcmp(argv[1], "--batch") == 0)
+    {
+        return batchMain(argc, argv);
+    }
+
     std::string name = "SCHRAGE";
 
     for (int i = 1; i < 10; i++)
@@ -90,53 +156,134 @@ int main()
         std::string datFile = name + std::to_string(i) + ".dat";
         std::string outFile = name + std::to_string(i) + ".out";
 
-        std::vector<task> tasks = loadTasksFromFile(datFile);
-        int correctAnswer = readCorrectOutcome(outFile);
+        LoadResult loaded = loadInstance("data/" + datFile);
+        if (!loaded)
+        {
+            std::cerr << loaded.error << std::endl;
+            continue;
+        }
+
+        const Instance &instance = loaded.instance;
+        ScratchArena arena;
+        std::vector<int> order;
+        OutcomeResult outcome = readCorrectOutcome("data/" + outFile);
+        if (!outcome)
+        {
+            std::cerr << outcome.error << std::endl;
+            continue;
+        }
+        int correctAnswer = outcome.value;
 
         std::cout << "==================================================" << std::endl;
         std::cout << "Wyniki dla pliku: " << datFile << std::endl;
         std::cout << "Dane w pliku: " << correctAnswer << std::endl;
+
+        const LowerBounds bounds = lowerBounds(instance, arena);
+        const int LB = bounds.best();
+        std::cout << "Dolne ograniczenie: " << LB << " (z wywłaszczaniem: " << bounds.preemptive
+                  << ", pojedyncze zadanie: " << bounds.singleJob << ", blokowe: " << bounds.block << ")" << std::endl;
         std::cout << "==================================================" << std::endl;
         std::cout << std::endl;
 
-        auto [qjMax, elapsed_gj] = measureExecutionTime(rjSortPlaning, tasks);
-        std::cout << "QjSort Cmax: " << qjMax << std::endl;
+        auto [qjMax, elapsed_gj] = measureExecutionTime(rjSortPlaning, instance, arena, order);
+        std::cout << "QjSort Cmax: " << qjMax << formatGap(qjMax, LB) << std::endl;
         std::cout << "Czas działania algorytmu QjSort: " << elapsed_gj << " sekund" << std::endl;
 
         std::cout << std::endl;
 
-        auto [rjMax, elapsed_rj] = measureExecutionTime(qjSortPlaning, tasks);
-        std::cout << "RjSort Cmax: " << rjMax << std::endl;
+        auto [rjMax, elapsed_rj] = measureExecutionTime(qjSortPlaning, instance, arena, order);
+        std::cout << "RjSort Cmax: " << rjMax << formatGap(rjMax, LB) << std::endl;
         std::cout << "Czas działania algorytmu RjSort: " << elapsed_rj << " sekund" << std::endl;
 
         std::cout << std::endl;
 
         if (i <= 2)
         {
-            auto [bruteCmax, elapsed_brute] = measureExecutionTime(bruteForce, tasks);
-            std::cout << "Brute force Cmax: " << bruteCmax << std::endl;
+            auto [bruteCmax, elapsed_brute] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return bruteForce(instance, arena, order); }, instance, arena, order);
+            std::cout << "Brute force Cmax: " << bruteCmax << formatGap(bruteCmax, LB) << std::endl;
             std::cout << "Czas działania algorytmu brute force: " << elapsed_brute << " sekund" << std::endl;
 
             std::cout << std::endl;
+
+            auto [bruteParallelCmax, elapsed_bruteParallel] = measureExecutionTime([](const Instance &instance, ScratchArena &, std::vector<int> &order) { return bruteForceParallel(instance, order, 0); }, instance, arena, order);
+            std::cout << "Brute force równoległy Cmax: " << bruteParallelCmax << formatGap(bruteParallelCmax, LB) << std::endl;
+            std::cout << "Czas działania algorytmu brute force równoległego: " << elapsed_bruteParallel << " sekund" << std::endl;
+
+            std::cout << std::endl;
         }
 
-        auto [schargeCmax, elapsed_schrage] = measureExecutionTime(schragePlaning, tasks);
-        std::cout << "Scharge Cmax: " << schargeCmax << std::endl;
+        if (instance.size() <= 20)
+        {
+            auto [dpCmax, elapsed_dp] = measureExecutionTime(bitmaskDPPlaning, instance, arena, order);
+            std::cout << "Programowanie dynamiczne Cmax: " << dpCmax << formatGap(dpCmax, LB) << std::endl;
+            std::cout << "Czas działania programowania dynamicznego: " << elapsed_dp << " sekund" << std::endl;
+
+            std::cout << std::endl;
+        }
+
+        auto [schargeCmax, elapsed_schrage] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return schragePlaning(instance, arena, order); }, instance, arena, order);
+        std::cout << "Scharge Cmax: " << schargeCmax << formatGap(schargeCmax, LB) << std::endl;
         std::cout << "Czas działania algorytmu Scharge: " << elapsed_schrage << " sekund" << std::endl;
 
         std::cout << std::endl;
 
-        auto [schargePreemptiveCmax, elapsed_schragePreemptive] = measureExecutionTime(schragePreemptivePlaning, tasks);
+        auto [schargePreemptiveCmax, elapsed_schragePreemptive] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &) { return schragePreemptivePlaning(instance, arena); }, instance, arena, order);
         std::cout << "SchargePreemptive Cmax: " << schargePreemptiveCmax << std::endl;
         std::cout << "Czas działania algorytmu Scharge z wywłaszczeniem: " << elapsed_schragePreemptive << " sekund" << std::endl;
 
         std::cout << std::endl;
 
-        auto [WSPTCmax, elapsed_WSPT] = measureExecutionTime(weightedSPTPlaning, tasks);
-        std::cout << "WSPT Cmax: " << WSPTCmax << std::endl;
+        auto [WSPTCmax, elapsed_WSPT] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return weightedSPTPlaning(instance, arena, order); }, instance, arena, order);
+        std::cout << "WSPT Cmax: " << WSPTCmax << formatGap(WSPTCmax, LB) << std::endl;
         std::cout << "Czas działania algorytmu WSPT: " << elapsed_WSPT << " sekund" << std::endl;
 
         std::cout << std::endl;
+
+        WsptTuning tuning;
+        auto [tunedCmax, elapsed_tuned] = measureExecutionTime([&tuning](const Instance &instance, ScratchArena &, std::vector<int> &order) { tuning = tuneWsptWeights(instance, order); return tuning.Cmax; }, instance, arena, order);
+        std::cout << "WSPT z dobranymi wagami Cmax: " << tunedCmax << formatGap(tunedCmax, LB) << ", waga q: "
+                  << tuning.weights.q << std::endl;
+        std::cout << "Czas działania strojenia WSPT: " << elapsed_tuned << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        auto [tabuCmax, elapsed_tabu] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return tabuSearchPlaning(instance, arena, order); }, instance, arena, order);
+        std::cout << "Tabu Cmax: " << tabuCmax << formatGap(tabuCmax, LB) << std::endl;
+        std::cout << "Czas działania przeszukiwania z tabu: " << elapsed_tabu << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        auto [annealingCmax, elapsed_annealing] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return simulatedAnnealingPlaning(instance, arena, order); }, instance, arena, order);
+        std::cout << "Symulowane wyżarzanie Cmax: " << annealingCmax << formatGap(annealingCmax, LB) << std::endl;
+        std::cout << "Czas działania symulowanego wyżarzania: " << elapsed_annealing << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        auto [geneticCmax, elapsed_genetic] = measureExecutionTime([](const Instance &instance, ScratchArena &, std::vector<int> &order) { return geneticPlaning(instance, order); }, instance, arena, order);
+        std::cout << "Algorytm genetyczny Cmax: " << geneticCmax << formatGap(geneticCmax, LB) << std::endl;
+        std::cout << "Czas działania algorytmu genetycznego: " << elapsed_genetic << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        PortfolioResult portfolio;
+        auto [portfolioCmax, elapsed_portfolio] = measureExecutionTime([&portfolio](const Instance &instance, ScratchArena &, std::vector<int> &order) { portfolio = portfolioPlaning(instance, order); return portfolio.Cmax; }, instance, arena, order);
+        std::cout << "Portfolio Cmax: " << portfolioCmax << formatGap(portfolioCmax, LB) << ", znalazł: "
+                  << portfolio.algorithm << (portfolio.optimal ? " (optimum)" : "") << std::endl;
+        std::cout << "Czas działania portfolio: " << elapsed_portfolio << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        auto [carlierCmax, elapsed_carlier] = measureExecutionTime([](const Instance &instance, ScratchArena &arena, std::vector<int> &order) { return carlierPlaning(instance, arena, order); }, instance, arena, order);
+        std::cout << "Carlier Cmax: " << carlierCmax << formatGap(carlierCmax, LB) << std::endl;
+        std::cout << "Czas działania algorytmu Carlier: " << elapsed_carlier << " sekund" << std::endl;
+
+        std::cout << std::endl;
+
+        auto [carlierParallelCmax, elapsed_carlierParallel] = measureExecutionTime([](const Instance &instance, ScratchArena &, std::vector<int> &order) { return carlierParallelPlaning(instance, order, 0); }, instance, arena, order);
+        std::cout << "Carlier równoległy Cmax: " << carlierParallelCmax << formatGap(carlierParallelCmax, LB) << std::endl;
+        std::cout << "Czas działania algorytmu Carlier równoległy: " << elapsed_carlierParallel << " sekund" << std::endl;
+
+        std::cout << std::endl;
     }
 
     return 0;
@@ -0,0 +1,46 @@
+#include "mapped_file.h"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+std::shared_ptr<const MappedFile> MappedFile::open(const std::string &path, std::string &error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "Nie można otworzyć pliku: " + path + " (" + std::strerror(errno) + ")";
+        return nullptr;
+    }
+
+    struct stat info{};
+    if (fstat(fd, &info) != 0) {
+        error = "Nie można odczytać rozmiaru pliku: " + path + " (" + std::strerror(errno) + ")";
+        ::close(fd);
+        return nullptr;
+    }
+
+    // Pustego pliku nie da się odwzorować - zwracamy pusty obszar
+    const size_t length = static_cast<size_t>(info.st_size);
+    if (length == 0) {
+        ::close(fd);
+        return std::shared_ptr<const MappedFile>(new MappedFile(nullptr, 0));
+    }
+
+    void *address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        error = "Nie można odwzorować pliku w pamięci: " + path + " (" + std::strerror(errno) + ")";
+        return nullptr;
+    }
+
+    // Plik czytamy raz od początku do końca
+    madvise(address, length, MADV_SEQUENTIAL);
+    return std::shared_ptr<const MappedFile>(new MappedFile(static_cast<const char *>(address), length));
+}
+
+MappedFile::~MappedFile() {
+    if (bytes) {
+        munmap(const_cast<char *>(bytes), length);
+    }
+}
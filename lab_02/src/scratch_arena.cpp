@@ -0,0 +1,45 @@
+#include "scratch_arena.h"
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Przydziela bajty z bieżącego bloku, w razie potrzeby przechodząc do następnego lub tworząc nowy.
+ */
+void *ScratchArena::allocateBytes(size_t bytes, size_t alignment) {
+    while (current < blocks.size()) {
+        auto base = reinterpret_cast<std::uintptr_t>(blocks[current].data.get());
+        size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+        if (aligned + bytes <= blocks[current].size) {
+            offset = aligned + bytes;
+            return blocks[current].data.get() + aligned;
+        }
+        // Bieżący blok jest pełny - próbujemy następnego (pozostałego po wcześniejszym rewind)
+        current++;
+        offset = 0;
+    }
+
+    // Brak miejsca - nowy blok co najmniej dwa razy większy od poprzedniego
+    size_t size = std::max(bytes + alignment, blocks.empty() ? size_t(4096) : 2 * blocks.back().size);
+    blocks.push_back({std::unique_ptr<std::byte[]>(new std::byte[size]), size});
+    current = blocks.size() - 1;
+    offset = 0;
+    return allocateBytes(bytes, alignment);
+}
+
+void ScratchArena::reset() {
+    if (blocks.size() > 1) {
+        size_t total = capacity();
+        blocks.clear();
+        blocks.push_back({std::unique_ptr<std::byte[]>(new std::byte[total]), total});
+    }
+    current = 0;
+    offset = 0;
+}
+
+size_t ScratchArena::capacity() const {
+    size_t total = 0;
+    for (const auto &block: blocks) {
+        total += block.size;
+    }
+    return total;
+}
@@ -0,0 +1,246 @@
+#include "wspt_tuner.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include "alg_01_schrage.h"
+#include "scratch_arena.h"
+#include "thread_pool.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Zadanie w buforze kluczy: priorytet razem z danymi zadania, więc przeliczenie kluczy
+ * i obliczenie Cmax czytają bufor sekwencyjnie, bez sięgania do kolumn instancji.
+ */
+struct KeyedTask {
+    double key;
+    int job;
+    int r, p, q;
+};
+
+/**
+ * @brief Kolejność WSPT: priorytet, przy remisie mniejszy indeks (jak w weightedSPTPlaning)
+ */
+inline bool before(const KeyedTask &a, const KeyedTask &b) {
+    return a.key < b.key || (a.key == b.key && a.job < b.job);
+}
+
+/**
+ * @brief Ocenia wagi na rodzinie instancji; bufory kluczy są przydzielane raz z areny wątku.
+ */
+class FamilyEvaluator {
+private:
+    const std::vector<const Instance *> &family;
+    const double *scale;   ///< Dolne ograniczenie każdej instancji
+    KeyedTask **buffers;   ///< Bufor kluczy każdej instancji, posortowany dla ostatnio ocenianych wag
+
+public:
+    FamilyEvaluator(const std::vector<const Instance *> &family, const double *scale, ScratchArena &arena)
+            : family(family), scale(scale), buffers(arena.allocate<KeyedTask *>(family.size())) {
+        for (size_t i = 0; i < family.size(); i++) {
+            const Instance &instance = *family[i];
+            buffers[i] = arena.allocate<KeyedTask>(instance.size());
+            for (int j = 0; j < instance.size(); j++) {
+                buffers[i][j] = {0.0, j, instance.r()[j], instance.p()[j], instance.q()[j]};
+            }
+        }
+    }
+
+    /**
+     * @brief Średnie Cmax / dolne ograniczenie po instancjach; bez alokacji
+     */
+    double operator()(const WsptWeights &weights) {
+        double sum = 0;
+        for (size_t i = 0; i < family.size(); i++) {
+            KeyedTask *tasks = buffers[i];
+            const int n = family[i]->size();
+            int descents = 0;
+            for (int k = 0; k < n; k++) {
+                tasks[k].key = wsptPriority(tasks[k].p, tasks[k].q, tasks[k].r, weights);
+                descents += k > 0 && before(tasks[k], tasks[k - 1]);
+            }
+            // Bufor jest posortowany dla poprzednich wag; std::sort dobrze znosi dane prawie posortowane,
+            // a sortowanie przez wstawianie przegrywało już przy zmianie wagi q o 0.05 (zbyt wiele inwersji)
+            if (descents > 0) {
+                std::sort(tasks, tasks + n, before);
+            }
+
+            int currentTime = 0, Cmax = 0;
+            for (int k = 0; k < n; k++) {
+                currentTime = std::max(currentTime, tasks[k].r) + tasks[k].p;
+                Cmax = std::max(Cmax, currentTime + tasks[k].q);
+            }
+            sum += Cmax / scale[i];
+        }
+        return sum / family.size();
+    }
+};
+
+/**
+ * @brief Oceniony zestaw wag; remisy rozstrzyga mniejsze r, potem mniejsze q, więc wynik
+ * nie zależy od podziału pracy między wątki.
+ */
+struct Candidate {
+    double score = INFINITY;
+    WsptWeights weights;
+    long evaluations = 0;
+
+    void consider(double value, const WsptWeights &w) {
+        evaluations++;
+        if (value < score || (value == score && (w.r < weights.r || (w.r == weights.r && w.q < weights.q)))) {
+            score = value;
+            weights = w;
+        }
+    }
+
+    void merge(const Candidate &other) {
+        if (other.evaluations > 0) {
+            const long total = evaluations + other.evaluations;
+            consider(other.score, other.weights);
+            evaluations = total;
+        }
+    }
+};
+
+/**
+ * @brief i-ty z count równo rozłożonych punktów przedziału [low, high]
+ */
+double gridPoint(double low, double high, int i, int count) {
+    return count > 1 ? low + (high - low) * i / (count - 1) : low;
+}
+
+/**
+ * @brief Złoty podział wagi q w przedziale [low, high] przy stałej wadze r.
+ *
+ * Cmax jako funkcja wagi jest schodkowy i zwykle nie jest unimodalny, dlatego zapamiętujemy
+ * najlepszy ze wszystkich ocenionych punktów, a nie tylko końcowy środek przedziału.
+ */
+void goldenSection(FamilyEvaluator &evaluate, double low, double high, double r, int iterations,
+                   Candidate &best) {
+    const double ratio = (std::sqrt(5.0) - 1) / 2;
+    auto at = [&](double q) {
+        const double value = evaluate({q, r});
+        best.consider(value, {q, r});
+        return value;
+    };
+
+    at(low);
+    at(high);
+    double c = high - ratio * (high - low), d = low + ratio * (high - low);
+    double fc = at(c), fd = at(d);
+    for (int it = 0; it < iterations; it++) {
+        if (fc <= fd) {
+            high = d;
+            d = c;
+            fd = fc;
+            c = high - ratio * (high - low);
+            fc = at(c);
+        } else {
+            low = c;
+            c = d;
+            fc = fd;
+            d = low + ratio * (high - low);
+            fd = at(d);
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Dobiera wagi priorytetu WSPT dla rodziny instancji.
+ *
+ * Minimalizowane jest średnie Cmax / dolne ograniczenie (Schrage z wywłaszczaniem), więc każda
+ * instancja waży tyle samo niezależnie od skali. Punkty przestrzeni wag są dzielone między wątki
+ * puli; każde zadanie puli przydziela bufory kluczy raz i ocenia kolejne, bliskie sobie wagi.
+ * Ocena to przeliczenie kluczy, dosortowanie bufora i jeden przebieg obliczający Cmax.
+ *
+ * @param family Instancje, dla których dobieramy wspólne wagi (niepuste).
+ * @param options Zakresy wag, sposób przeszukiwania i liczba wątków.
+ * @return Najlepsze wagi, ich ocena, liczba ocen i czas strojenia.
+ */
+WsptTuning tuneWsptWeights(const std::vector<const Instance *> &family, const WsptTunerOptions &options) {
+    const Clock::time_point start = Clock::now();
+    WsptTuning tuning;
+    if (family.empty()) {
+        return tuning;
+    }
+
+    std::vector<double> scale(family.size());
+    {
+        ScratchArena arena;
+        for (size_t i = 0; i < family.size(); i++) {
+            scale[i] = std::max(1, schragePreemptivePlaning(*family[i], arena));
+        }
+    }
+
+    const int qSteps = std::max(options.qSteps, 1);
+    const int rSteps = options.tuneR ? std::max(options.rSteps, 1) : 1;
+    auto rValue = [&](int i) { return options.tuneR ? gridPoint(options.rMin, options.rMax, i, rSteps) : 0.0; };
+
+    const int threads = std::max(options.threadCount > 0 ? options.threadCount
+                                                         : static_cast<int>(std::thread::hardware_concurrency()), 1);
+    const bool grid = options.search == WsptSearch::Grid;
+    const int brackets = std::max(options.goldenBrackets, 1);
+    // Siatka: ciągłe fragmenty punktów (q zmienia się najszybciej, więc kolejne oceny są bliskie);
+    // złoty podział: jedno zadanie na parę (wartość r, przedział q)
+    const long points = static_cast<long>(qSteps) * rSteps;
+    const int jobs = grid ? static_cast<int>(std::min<long>(threads, points)) : rSteps * brackets;
+    std::vector<Candidate> results(jobs);
+
+    {
+        ThreadPool pool(std::min(threads, jobs));
+        for (int job = 0; job < jobs; job++) {
+            pool.submit([&, job] {
+                // Pamięć robocza żyje w wątku puli; zakres zwalnia bufory po zakończeniu zadania
+                thread_local ScratchArena arena;
+                ScratchArena::Scope scope(arena);
+                FamilyEvaluator evaluate(family, scale.data(), arena);
+                Candidate &best = results[job];
+
+                if (grid) {
+                    const long first = points * job / jobs, last = points * (job + 1) / jobs;
+                    for (long k = first; k < last; k++) {
+                        const WsptWeights weights{gridPoint(options.qMin, options.qMax, static_cast<int>(k % qSteps), qSteps),
+                                                  rValue(static_cast<int>(k / qSteps))};
+                        best.consider(evaluate(weights), weights);
+                    }
+                } else {
+                    const int bracket = job % brackets;
+                    goldenSection(evaluate, gridPoint(options.qMin, options.qMax, bracket, brackets + 1),
+                                  gridPoint(options.qMin, options.qMax, bracket + 1, brackets + 1),
+                                  rValue(job / brackets), options.goldenIterations, best);
+                }
+            });
+        }
+        pool.wait();
+    }
+
+    Candidate best;
+    for (const Candidate &result: results) {
+        best.merge(result);
+    }
+    tuning.weights = best.weights;
+    tuning.score = best.score;
+    tuning.evaluations = best.evaluations;
+    tuning.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return tuning;
+}
+
+/**
+ * @brief Dobiera wagi WSPT dla jednej instancji i zwraca uszeregowanie dla najlepszych wag.
+ *
+ * @param instance Instancja problemu.
+ * @param order Wektor, który otrzyma permutację WSPT dla najlepszych wag.
+ * @param options Zakresy wag, sposób przeszukiwania i liczba wątków.
+ * @return Najlepsze wagi z Cmax, liczbą ocen i czasem strojenia.
+ */
+WsptTuning tuneWsptWeights(const Instance &instance, std::vector<int> &order, const WsptTunerOptions &options) {
+    WsptTuning tuning = tuneWsptWeights(std::vector<const Instance *>{&instance}, options);
+    ScratchArena arena;
+    tuning.Cmax = weightedSPTPlaning(instance, arena, order, tuning.weights);
+    return tuning;
+}
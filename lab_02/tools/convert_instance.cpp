@@ -0,0 +1,99 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "binary_instance.h"
+#include "instance_io.h"
+
+/**
+ * @brief Konwertuje instancję flow shop z pliku CSV (lab_04/instances) do formatu binarnego.
+ *
+ * Format CSV jak w FlowShop::loadFromFile: wiersz nagłówków, potem w każdym wierszu nazwa
+ * zadania i czasy przetwarzania na kolejnych maszynach rozdzielone przecinkami.
+ *
+ * @return Opis błędu; pusty, jeśli konwersja się powiodła.
+ */
+static std::string convertCsv(const std::string &input, const std::string &output) {
+    std::ifstream file(input);
+    if (!file) {
+        return "Nie można otworzyć pliku: " + input;
+    }
+
+    std::string line;
+    if (!std::getline(file, line)) {
+        return "Pusty plik: " + input;
+    }
+
+    // Kolumny maszyn budujemy od razu w układzie docelowym
+    std::vector<std::vector<int32_t>> machines;
+    int jobs = 0;
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string cell;
+        if (!std::getline(ss, cell, ',')) {
+            continue;
+        }
+
+        size_t machine = 0;
+        while (std::getline(ss, cell, ',')) {
+            if (cell.empty() || cell == "\r") {
+                continue;
+            }
+            if (jobs == 0) {
+                machines.emplace_back();
+            }
+            if (machine >= machines.size()) {
+                return "Nieprawidłowa liczba czasów przetwarzania w wierszu " + std::to_string(jobs + 1);
+            }
+            try {
+                machines[machine++].push_back(std::stoi(cell));
+            } catch (const std::exception &e) {
+                return "Błąd konwersji w wierszu " + std::to_string(jobs + 1) + ": " + e.what();
+            }
+        }
+        if (machine != machines.size()) {
+            return "Nieprawidłowa liczba czasów przetwarzania w wierszu " + std::to_string(jobs + 1);
+        }
+        jobs++;
+    }
+
+    std::vector<const int32_t *> columns;
+    for (const auto &machine: machines) {
+        columns.push_back(machine.data());
+    }
+
+    std::string error;
+    writeBinaryInstance(output, BinaryInstanceKind::FlowShop, static_cast<uint32_t>(jobs), columns, error);
+    return error;
+}
+
+/**
+ * @brief Narzędzie konwersji instancji do binarnego formatu z binary_instance.h.
+ *
+ * Pliki .dat (1|r_j,q_j|Cmax, lab_02/data) trafiają do kolumn r, p, q, a pliki .csv
+ * (flow shop, lab_04/instances) do kolumn czasów przetwarzania na kolejnych maszynach.
+ *
+ * Użycie: convert_instance <wejście.dat|wejście.csv> <wyjście.bin>
+ */
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        std::cerr << "Użycie: " << argv[0] << " <wejście.dat|wejście.csv> <wyjście.bin>" << std::endl;
+        return 1;
+    }
+
+    const std::string input = argv[1], output = argv[2];
+    std::string error;
+    if (input.size() >= 4 && input.compare(input.size() - 4, 4, ".csv") == 0) {
+        error = convertCsv(input, output);
+    } else {
+        LoadResult loaded = loadInstance(input);
+        error = loaded ? saveBinaryInstance(loaded.instance, output) : loaded.error;
+    }
+
+    if (!error.empty()) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "instance_generator.h"
+
+/**
+ * @brief Wypisuje sposób użycia programu.
+ */
+static void usage(const char *program) {
+    std::cerr << "Użycie: " << program << " <wyjście.dat|wyjście.bin> [--n N] [--seed S]\n"
+              << "       [--distribution uniform|correlated|tight] [--p-min A] [--p-max B]\n"
+              << "       [--window W] [--correlation C] [--threads T] [--format dat|bin]" << std::endl;
+}
+
+/**
+ * @brief Generator instancji 1|r_j,q_j|Cmax o rozmiarach od 10^3 do 10^8 zadań.
+ *
+ * Format wynikowy wynika z rozszerzenia pliku (.bin - binarny, inaczej .dat), chyba że podano
+ * --format. Te same parametry i ziarno zawsze dają identyczny plik, niezależnie od liczby wątków.
+ */
+int main(int argc, char **argv) {
+    GeneratorOptions options;
+    std::string output;
+    std::string format;
+
+    for (int i = 1; i < argc; i++) {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--n") == 0 && hasValue) {
+            options.n = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--distribution") == 0 && hasValue) {
+            const std::string name = argv[++i];
+            if (name == "uniform") {
+                options.distribution = TaskDistribution::Uniform;
+            } else if (name == "correlated") {
+                options.distribution = TaskDistribution::Correlated;
+            } else if (name == "tight") {
+                options.distribution = TaskDistribution::Tight;
+            } else {
+                std::cerr << "Nieznany rozkład: " << name << std::endl;
+                return 1;
+            }
+        } else if (std::strcmp(argv[i], "--p-min") == 0 && hasValue) {
+            options.pMin = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--p-max") == 0 && hasValue) {
+            options.pMax = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--window") == 0 && hasValue) {
+            options.window = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--correlation") == 0 && hasValue) {
+            options.correlation = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threadCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--format") == 0 && hasValue) {
+            format = argv[++i];
+            if (format != "dat" && format != "bin") {
+                std::cerr << "Nieznany format: " << format << std::endl;
+                return 1;
+            }
+        } else if (std::strncmp(argv[i], "--", 2) == 0 || !output.empty()) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            output = argv[i];
+        }
+    }
+
+    if (output.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (format.empty()) {
+        format = output.size() >= 4 && output.compare(output.size() - 4, 4, ".bin") == 0 ? "bin" : "dat";
+    }
+
+    const int W = releaseWindow(options);
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::string error = writeGeneratedInstance(options, output,
+                                                     format == "bin" ? InstanceFormat::Binary : InstanceFormat::Text);
+    if (!error.empty()) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Zapisano " << options.n << " zadań (W = " << W << ", ziarno " << options.seed << ") do "
+              << output << " w " << seconds << " s" << std::endl;
+    return 0;
+}
@@ -1,4 +1,6 @@
 #include "flowshop.h"
+#include "binary_instance.h"
+#include "instrumentation.h"
 
 /**
  * @brief Wczytuje dane z pliku CSV
@@ -6,6 +8,7 @@
  * - Pierwszy wiersz zawiera nagłówki
  * - Kolejne wiersze zawierają czasy przetwarzania dla każdej maszyny
  * - Wartości są rozdzielone przecinkami
+ * Plik zaczynający się sygnaturą formatu binarnego jest przekazywany do loadFromBinary.
  * @param filename Ścieżka do pliku wejściowego
  * @return true jeśli wczytywanie się powiodło, false w przeciwnym razie
  */
@@ -16,6 +19,14 @@ bool FlowShop::loadFromFile(const std::string &filename) {
         return false;
     }
 
+    char magic[sizeof(BINARY_INSTANCE_MAGIC)] = {};
+    file.read(magic, sizeof(magic));
+    if (isBinaryInstance(magic, static_cast<size_t>(file.gcount()))) {
+        return loadFromBinary(filename);
+    }
+    file.clear();
+    file.seekg(0);
+
     jobs.clear();
     std::string line;
 
@@ -74,12 +85,54 @@ bool FlowShop::loadFromFile(const std::string &filename) {
     return true;
 }
 
+/**
+ * @brief Wczytuje dane z pliku binarnego
+ * @details Kolumna i pliku to czasy przetwarzania wszystkich zadań na maszynie i;
+ * plik tworzy narzędzie convert_instance z lab_02.
+ * @param filename Ścieżka do pliku wejściowego
+ * @return true jeśli wczytywanie się powiodło, false w przeciwnym razie
+ */
+bool FlowShop::loadFromBinary(const std::string &filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Nie można otworzyć pliku: " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::string error;
+    const BinaryInstanceHeader *header = readBinaryHeader(data.data(), data.size(), BinaryInstanceKind::FlowShop, error);
+    if (!header) {
+        std::cerr << filename << ": " << error << std::endl;
+        return false;
+    }
+    if (header->jobs == 0 || header->columns == 0) {
+        std::cerr << "Nie wczytano żadnych zadań" << std::endl;
+        return false;
+    }
+
+    numMachines = static_cast<int>(header->columns);
+    jobs.assign(header->jobs, Job());
+    for (uint32_t j = 0; j < header->jobs; j++) {
+        jobs[j].id = static_cast<int>(j);
+        jobs[j].processingTimes.resize(numMachines);
+    }
+    for (uint32_t m = 0; m < header->columns; m++) {
+        const int32_t *column = binaryColumn(data.data(), *header, m);
+        for (uint32_t j = 0; j < header->jobs; j++) {
+            jobs[j].processingTimes[m] = column[j];
+        }
+    }
+    return true;
+}
+
 /**
  * @brief Implementacja algorytmu NEH (Nawaz, Enscore, Ham)
  * @details Algorytm NEH składa się z następujących kroków:
  * 1. Obliczenie sum czasów przetwarzania dla każdego zadania
  * 2. Sortowanie zadań malejąco według tych sum
  * 3. Konstrukcja rozwiązania przez wstawianie zadań na najlepsze pozycje
+ * Instrumentacja zlicza sprawdzone pozycje wstawienia i obliczenia Cmax oraz mierzy fazy 1-2 i 3.
  * @return Para {najlepsza permutacja, wartość Cmax}
  * @complexity O(n²m), gdzie n - liczba zadań, m - liczba maszyn
  */
@@ -91,18 +144,20 @@ std::pair<std::vector<int>, int> FlowShop::neh() const {
     // Oblicz sumy czasów przetwarzania dla każdego zadania
     std::vector<std::pair<int, int>> jobSums;
     jobSums.reserve(jobs.size());  // Rezerwacja pamięci z góry
-
-    for (size_t i = 0; i < jobs.size(); ++i) {
-        int sum = 0;
-        for (int time: jobs[i].processingTimes) {
-            sum += time;
+    {
+        INSTRUMENT_SCOPE(Prepare);
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            int sum = 0;
+            for (int time: jobs[i].processingTimes) {
+                sum += time;
+            }
+            jobSums.emplace_back(sum, i);
         }
-        jobSums.emplace_back(sum, i);
-    }
 
-    // Sortuj malejąco według sum czasów przetwarzania
-    std::sort(jobSums.begin(), jobSums.end(),
-              [](const auto &a, const auto &b) { return a.first > b.first; });
+        // Sortuj malejąco według sum czasów przetwarzania
+        std::sort(jobSums.begin(), jobSums.end(),
+                  [](const auto &a, const auto &b) { return a.first > b.first; });
+    }
 
     // Inicjalizacja częściowego harmonogramu
     std::vector<int> partialSchedule;
@@ -110,6 +165,7 @@ std::pair<std::vector<int>, int> FlowShop::neh() const {
     partialSchedule.push_back(jobSums[0].second);
 
     // Wstawiaj kolejne zadania na najlepszą pozycję
+    INSTRUMENT_SCOPE(Construct);
     for (size_t i = 1; i < jobs.size(); ++i) {
         int currentJob = jobSums[i].second;
         int bestPos = 0;
@@ -120,6 +176,7 @@ std::pair<std::vector<int>, int> FlowShop::neh() const {
         for (size_t j = 0; j <= partialSchedule.size(); ++j) {
             std::vector<int> testSchedule = partialSchedule;
             testSchedule.insert(testSchedule.begin() + j, currentJob);
+            INSTRUMENT_COUNT(Insertion);
 
             int makespan = calculateMakespan(testSchedule);
             if (makespan < bestMakespan) {
@@ -147,6 +204,7 @@ int FlowShop::calculateMakespan(const std::vector<int> &permutation) const {
     if (permutation.empty() || jobs.empty() || numMachines == 0) {
         return 0;
     }
+    INSTRUMENT_COUNT(Evaluation);
 
     std::vector<int> machineTime(numMachines, 0);
 
@@ -207,19 +265,54 @@ std::vector<std::vector<int>> FlowShop::calculateCompletionTimes(const std::vect
  * @complexity O(n!), gdzie n - liczba zadań
  */
 std::pair<std::vector<int>, int> FlowShop::bruteForce() const {
-    std::vector<int> bestPermutation(jobs.size());
+    return bruteForce(AnytimeControl());
+}
+
+/**
+ * @brief Przegląd zupełny z możliwością przerwania
+ * @details Rozwiązaniem początkowym jest wynik NEH, więc przerwany przegląd zwraca co najmniej jego
+ * jakość. Przerwanie (flaga lub termin z control) sprawdzane jest co 256 permutacji, a każda lepsza
+ * permutacja (także początkowa) trafia do control.improved. Czy przegląd przerwano, mówi
+ * control.interrupted().
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw
+ * @return Para {najlepsza znaleziona permutacja, wartość Cmax}; optymalna, jeśli przegląd nie został przerwany
+ * @complexity O(n!), gdzie n - liczba zadań
+ */
+std::pair<std::vector<int>, int> FlowShop::bruteForce(const AnytimeControl &control) const {
+    return bruteForce(control, neh().first);
+}
+
+/**
+ * @brief Przegląd zupełny z możliwością przerwania, zaczynający od podanego rozwiązania
+ * @details Pozwala policzyć rozwiązanie początkowe poza mierzonym fragmentem (pomiar samego przeglądu).
+ * @param control Flaga przerwania, termin i odbiorca kolejnych popraw
+ * @param seed Rozwiązanie początkowe - permutacja wszystkich zadań
+ * @return Jak bruteForce(control)
+ * @complexity O(n!), gdzie n - liczba zadań
+ */
+std::pair<std::vector<int>, int> FlowShop::bruteForce(const AnytimeControl &control,
+                                                      const std::vector<int> &seed) const {
+    std::vector<int> bestPermutation = seed;
+    int bestMakespan = calculateMakespan(seed);
+    control.improved(bestMakespan, bestPermutation);
+
     std::vector<int> currentPermutation(jobs.size());
     std::iota(currentPermutation.begin(), currentPermutation.end(), 0);
+    AnytimePoller poller(control, 256);
+    INSTRUMENT_SCOPE(Search);
 
-    int bestMakespan = INT_MAX;
-
-    do {
+    while (!poller.shouldStop()) {
         int currentMakespan = calculateMakespan(currentPermutation);
         if (currentMakespan < bestMakespan) {
             bestMakespan = currentMakespan;
             bestPermutation = currentPermutation;
+            control.improved(bestMakespan, bestPermutation);
+            INSTRUMENT_COUNT(Improvement);
         }
-    } while (std::next_permutation(currentPermutation.begin(), currentPermutation.end()));
+        if (!std::next_permutation(currentPermutation.begin(), currentPermutation.end())) {
+            break;
+        }
+    }
 
     return {bestPermutation, bestMakespan};
 }
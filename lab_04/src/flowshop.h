@@ -9,6 +9,7 @@
 #include <numeric>
 #include <iostream>
 #include <climits>
+#include "anytime.h"
 
 /**
  * @struct Job
@@ -55,12 +56,34 @@ public:
      */
     bool loadFromFile(const std::string& filename);
 
+    /**
+     * @brief Wczytuje dane z pliku w formacie binarnym (binary_instance.h)
+     * @param filename Ścieżka do pliku z danymi
+     * @return true jeśli wczytywanie się powiodło, false w przeciwnym razie
+     */
+    bool loadFromBinary(const std::string& filename);
+
     /**
      * @brief Implementacja algorytmu przeglądu zupełnego
      * @return Para {najlepsza permutacja, wartość Cmax}
      */
     std::pair<std::vector<int>, int> bruteForce() const;
 
+    /**
+     * @brief Przegląd zupełny z możliwością przerwania
+     * @param control Flaga przerwania, termin i odbiorca kolejnych popraw
+     * @return Para {najlepsza znaleziona permutacja, wartość Cmax}; przerwanie zgłasza control.interrupted()
+     */
+    std::pair<std::vector<int>, int> bruteForce(const AnytimeControl &control) const;
+
+    /**
+     * @brief Przegląd zupełny z możliwością przerwania, zaczynający od podanego rozwiązania
+     * @param control Flaga przerwania, termin i odbiorca kolejnych popraw
+     * @param seed Rozwiązanie początkowe (np. wynik NEH obliczony wcześniej przez wywołującego)
+     * @return Para {najlepsza znaleziona permutacja, wartość Cmax}; przerwanie zgłasza control.interrupted()
+     */
+    std::pair<std::vector<int>, int> bruteForce(const AnytimeControl &control, const std::vector<int> &seed) const;
+
     /**
      * @brief Implementacja algorytmu NEH z akceleracją (FNEH)
      * @return Para {najlepsza permutacja, wartość Cmax}
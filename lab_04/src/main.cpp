@@ -2,11 +2,13 @@
 #include <chrono>
 #include <iomanip>  // dla std::setw
 #include <iostream>
+#include "instrumentation.h"
 
 void printResults(const std::string &algorithmName,
                   const std::vector<int> &sequence,
                   int makespan,
-                  long long duration) {
+                  long long duration,
+                  const instrumentation::Sample &sample) {
     std::cout << "\nWynik algorytmu " << algorithmName << ":\n";
     std::cout << "Kolejność zadań: ";
     for (int jobIdx: sequence) {
@@ -14,6 +16,9 @@ void printResults(const std::string &algorithmName,
     }
     std::cout << "\nCmax: " << std::setw(4) << makespan;
     std::cout << "\nCzas wykonania: " << std::setw(5) << duration << "ms\n";
+    if (instrumentation::ENABLED) {
+        std::cout << "Instrumentacja: " << instrumentation::describe(sample) << "\n";
+    }
 }
 
 int main() {
@@ -31,38 +36,54 @@ int main() {
 
     // Johnson (dla pierwszych dwóch maszyn)
     {
+        instrumentation::Probe probe;
         auto start = std::chrono::high_resolution_clock::now();
         auto [perm, makespan] = flowshop.johnson();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now() - start).count();
-        printResults("Johnson (2 maszyny)", perm, makespan, duration);
+        printResults("Johnson (2 maszyny)", perm, makespan, duration, probe.finish());
     }
 
     // NEH
     {
+        instrumentation::Probe probe;
         auto start = std::chrono::high_resolution_clock::now();
         auto [perm, makespan] = flowshop.neh();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now() - start).count();
-        printResults("NEH", perm, makespan, duration);
+        printResults("NEH", perm, makespan, duration, probe.finish());
     }
 
     // FNEH
     {
+        instrumentation::Probe probe;
         auto start = std::chrono::high_resolution_clock::now();
         auto [perm, makespan] = flowshop.fneh();
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now() - start).count();
-        printResults("FNEH", perm, makespan, duration);
+        printResults("FNEH", perm, makespan, duration, probe.finish());
     }
 
-    // Przegląd zupełny (Brute Force)
+    // Przegląd zupełny (Brute Force) - dla dużych instancji przerywany po limicie czasu
     {
+        const double timeLimitSeconds = 5.0;
+        int improvements = 0;
+        AnytimeControl control;
+        control.setTimeLimit(timeLimitSeconds);
+        control.onImprovement = [&improvements](int, const std::vector<int> &) { improvements++; };
+
+        // Rozwiązanie początkowe liczone przed pomiarem - próbka obejmuje tylko sam przegląd
+        const std::vector<int> seed = flowshop.neh().first;
+        instrumentation::Probe probe;
         auto start = std::chrono::high_resolution_clock::now();
-        auto [perm, makespan] = flowshop.bruteForce();
+        auto [perm, makespan] = flowshop.bruteForce(control, seed);
         auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
                 std::chrono::high_resolution_clock::now() - start).count();
-        printResults("Przegląd zupełny", perm, makespan, duration);
+        printResults("Przegląd zupełny", perm, makespan, duration, probe.finish());
+        if (control.interrupted()) {
+            std::cout << "Przerwano po " << timeLimitSeconds << " s - najlepsze znalezione rozwiązanie"
+                      << " (poprawy: " << improvements << ")\n";
+        }
     }
 
     return 0;